@@ -219,8 +219,9 @@ static vtss_rc vtss_inst_default_set(vtss_state_t *vtss_state)
 vtss_rc vtss_inst_create(const vtss_inst_create_t *const create,
                          vtss_inst_t              *const inst)
 {
-    vtss_state_t *vtss_state;
-    vtss_arch_t  arch;
+    vtss_state_t    *vtss_state;
+    vtss_arch_t     arch;
+    vtss_prof_ctx_t prof;
 
     VTSS_D("enter, sizeof(*vtss_state): %zu", sizeof(*vtss_state));
 
@@ -228,6 +229,7 @@ vtss_rc vtss_inst_create(const vtss_inst_create_t *const create,
         return VTSS_RC_ERROR;
 
     VTSS_MEMSET(vtss_state, 0, sizeof(*vtss_state));
+    vtss_cmn_prof_start(vtss_state, &prof);
     vtss_state->cookie = VTSS_STATE_COOKIE;
     vtss_state->create = *create;
     vtss_state->chip_count = 1;
@@ -361,6 +363,7 @@ vtss_rc vtss_inst_create(const vtss_inst_create_t *const create,
     if (inst != NULL)
         *inst = vtss_state;
 
+    vtss_cmn_prof_end(vtss_state, &prof, "inst_create");
     VTSS_D("exit");
 
     return VTSS_RC_OK;
@@ -401,13 +404,16 @@ vtss_rc vtss_init_conf_get(const vtss_inst_t        inst,
 vtss_rc vtss_init_conf_set(const vtss_inst_t              inst,
                            const vtss_init_conf_t * const conf)
 {
-    vtss_state_t *vtss_state;
-    vtss_rc      rc;
+    vtss_state_t    *vtss_state;
+    vtss_rc         rc;
+    vtss_prof_ctx_t prof;
 
     VTSS_D("enter");
     if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
         vtss_state->init_conf = *conf;
+        vtss_cmn_prof_start(vtss_state, &prof);
         rc = VTSS_FUNC_0(cil.init_conf_set);
+        vtss_cmn_prof_end(vtss_state, &prof, "init_conf_set");
         vtss_state->warm_start_prev = vtss_state->warm_start_cur;
     } else {
         VTSS_E("Initialization check failed");
@@ -871,10 +877,16 @@ vtss_rc vtss_restart_conf_end(const vtss_inst_t inst)
             /* Leave warm start mode */
             vtss_state->warm_start_cur = 0;
 
-            /* Apply configuration */
+            /* Apply configuration. Tables supporting read back are only
+               written for entries differing from the chip */
             VTSS_I("warm start sync start");
+            vtss_state->sync_active = 1;
+            vtss_state->sync_entries = 0;
+            vtss_state->sync_changed = 0;
             rc = vtss_restart_sync(vtss_state);
-            VTSS_I("warm start sync done");
+            vtss_state->sync_active = 0;
+            VTSS_I("warm start sync done, %u/%u table entries changed",
+                   vtss_state->sync_changed, vtss_state->sync_entries);
         } else {
             VTSS_I("cold/cool start end");
         }
@@ -899,6 +911,8 @@ vtss_rc vtss_restart_status_get(const vtss_inst_t inst,
         status->restart = vtss_state->restart_prev;
         status->prev_version = vtss_state->version_prev;
         status->cur_version = vtss_state->version_cur;
+        status->sync_entries = vtss_state->sync_entries;
+        status->sync_changed = vtss_state->sync_changed;
     }
     VTSS_EXIT();
 
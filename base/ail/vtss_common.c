@@ -111,6 +111,74 @@ u32 vtss_cmn_restart_value_get(vtss_state_t *vtss_state)
                                  VTSS_RESTART_VERSION_WIDTH));
 }
 
+#if defined(VTSS_FEATURE_WARM_START)
+/* Differential warm start synchronization: Count checked table entry
+   and return TRUE if the entry read back from the chip must be written */
+BOOL vtss_cmn_sync_changed(vtss_state_t *vtss_state, BOOL changed)
+{
+    vtss_state->sync_entries++;
+    if (changed) {
+        vtss_state->sync_changed++;
+    }
+    return changed;
+}
+#endif /* VTSS_FEATURE_WARM_START */
+
+#if defined(VTSS_OS_TIME_USEC)
+/* Initialization profiling: Start a phase */
+void vtss_cmn_prof_start(vtss_state_t *vtss_state, vtss_prof_ctx_t *ctx)
+{
+    ctx->usec = VTSS_OS_TIME_USEC();
+    ctx->cpu_usec = VTSS_OS_CPU_USEC();
+    ctx->sleep_usec = vtss_state->prof.sleep_usec;
+    ctx->reg_rd = vtss_state->prof.reg_rd;
+    ctx->reg_wr = vtss_state->prof.reg_wr;
+}
+
+static BOOL vtss_prof_name_match(const char *a, const char *b)
+{
+    if (a == b) {
+        return TRUE;
+    }
+    while (*a != '\0' && *a == *b) {
+        a++;
+        b++;
+    }
+    return (*a == *b);
+}
+
+/* Initialization profiling: End a phase and add it to the phase with the same name */
+void vtss_cmn_prof_end(vtss_state_t *vtss_state, const vtss_prof_ctx_t *ctx, const char *name)
+{
+    vtss_prof_t       *prof = &vtss_state->prof;
+    vtss_prof_phase_t *phase;
+    u64               usec = (VTSS_OS_TIME_USEC() - ctx->usec);
+    u64               cpu_usec = (VTSS_OS_CPU_USEC() - ctx->cpu_usec);
+    u32               i;
+
+    for (i = 0; i < prof->phase_cnt; i++) {
+        if (vtss_prof_name_match(prof->phase[i].name, name)) {
+            break;
+        }
+    }
+    if (i == prof->phase_cnt) {
+        if (i == VTSS_PROF_PHASES) {
+            VTSS_D("no more phases, skipping %s", name);
+            return;
+        }
+        prof->phase_cnt++;
+        prof->phase[i].name = name;
+    }
+    phase = &prof->phase[i];
+    phase->cnt++;
+    phase->usec += usec;
+    phase->wait_usec += (usec > cpu_usec ? usec - cpu_usec : 0);
+    phase->sleep_usec += (prof->sleep_usec - ctx->sleep_usec);
+    phase->reg_rd += (prof->reg_rd - ctx->reg_rd);
+    phase->reg_wr += (prof->reg_wr - ctx->reg_wr);
+}
+#endif /* VTSS_OS_TIME_USEC */
+
 #if defined(VTSS_FEATURE_PORT_CONTROL)  ||  defined(VTSS_ARCH_OCELOT)
 /* Rebase 64-bit counter, i.e. discard changes since last update, based on 8-bit chip counter */
 void vtss_cmn_counter_8_rebase(u8 new_base_value, vtss_chip_counter_t *counter)
@@ -436,6 +504,23 @@ static void vtss_debug_print_init(vtss_state_t *vtss_state,
     pr("AFI Size   : %zu\n", sizeof(vtss_state->afi));
 #endif
     pr("\n");
+
+#if defined(VTSS_OS_TIME_USEC)
+    {
+        vtss_prof_t       *prof = &vtss_state->prof;
+        vtss_prof_phase_t *phase;
+        u32               i;
+
+        /* One CSV line per phase. Phases may be nested, e.g. init groups within init_conf_set */
+        pr("Profile: phase,cnt,usec,wait_usec,sleep_usec,reg_rd,reg_wr\n");
+        for (i = 0; i < prof->phase_cnt; i++) {
+            phase = &prof->phase[i];
+            pr("Profile: %s,%u,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%u,%u\n",
+               phase->name, phase->cnt, phase->usec, phase->wait_usec, phase->sleep_usec, phase->reg_rd, phase->reg_wr);
+        }
+        pr("Profile: total,0,0,0,%" PRIu64 ",%u,%u\n\n", prof->sleep_usec, prof->reg_rd, prof->reg_wr);
+    }
+#endif /* VTSS_OS_TIME_USEC */
 }
 
 /* Print port header, e.g, "0      7.8     15.16    23.24  28" */
@@ -13,6 +13,38 @@ vtss_rc vtss_port_no_check(vtss_state_t *vtss_state, const vtss_port_no_t port_n
 vtss_rc vtss_port_no_none_check(vtss_state_t *vtss_state, const vtss_port_no_t port_no);
 vtss_rc vtss_cmn_restart_update(vtss_state_t *vtss_state, u32 value);
 u32 vtss_cmn_restart_value_get(vtss_state_t *vtss_state);
+#if defined(VTSS_FEATURE_WARM_START)
+BOOL vtss_cmn_sync_changed(vtss_state_t *vtss_state, BOOL changed);
+#endif /* VTSS_FEATURE_WARM_START */
+
+#if defined(VTSS_OS_TIME_USEC)
+void vtss_cmn_prof_start(vtss_state_t *vtss_state, vtss_prof_ctx_t *ctx);
+void vtss_cmn_prof_end(vtss_state_t *vtss_state, const vtss_prof_ctx_t *ctx, const char *name);
+
+/* Evaluate expression as a profiled phase, returning on error like VTSS_RC() */
+#define VTSS_PROF_RC(name, expr) {                                       \
+    vtss_prof_ctx_t __ctx__;                                             \
+    vtss_rc         __rc__;                                              \
+    vtss_cmn_prof_start(vtss_state, &__ctx__);                           \
+    __rc__ = (expr);                                                     \
+    vtss_cmn_prof_end(vtss_state, &__ctx__, name);                       \
+    if (__rc__ < VTSS_RC_OK) return __rc__;                              \
+}
+#else
+#define vtss_cmn_prof_start(vtss_state, ctx) (void)(ctx)
+#define vtss_cmn_prof_end(vtss_state, ctx, name) (void)(ctx)
+#define VTSS_PROF_RC(name, expr) VTSS_RC(expr)
+#endif /* VTSS_OS_TIME_USEC */
+
+/* Sleep and count the requested time in the profile (benchmark of the bring-up waits) */
+#define VTSS_PROF_MSLEEP(msec) {                                         \
+    vtss_state->prof.sleep_usec += (u64)(msec) * 1000;                   \
+    VTSS_MSLEEP(msec);                                                   \
+}
+#define VTSS_PROF_NSLEEP(nsec) {                                         \
+    vtss_state->prof.sleep_usec += (u64)(nsec) / 1000;                   \
+    VTSS_NSLEEP(nsec);                                                   \
+}
 
 #if defined(VTSS_FEATURE_PORT_CONTROL)  ||  defined(VTSS_FEATURE_VOP)
 typedef enum {
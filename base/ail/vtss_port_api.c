@@ -38,6 +38,7 @@ vtss_rc vtss_port_map_set(const vtss_inst_t      inst,
     vtss_port_no_t  port_no;
     vtss_rc         rc;
     vtss_port_map_t *pmap;
+    vtss_prof_ctx_t prof;
 
     VTSS_D("enter");
     if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
@@ -82,7 +83,9 @@ vtss_rc vtss_port_map_set(const vtss_inst_t      inst,
                 pgid_entry->member[port_no] = 1;
         }
 #endif /* VTSS_FEATURE_LAYER2 */
+        vtss_cmn_prof_start(vtss_state, &prof);
         rc = VTSS_FUNC_0(port.map_set);
+        vtss_cmn_prof_end(vtss_state, &prof, "port_map_set");
 #if defined(VTSS_FEATURE_LAYER2)
         if (rc == VTSS_RC_OK) /* Update destination masks */
             rc = vtss_update_masks(vtss_state, 0, 1, 0);
@@ -148,6 +151,7 @@ vtss_rc vtss_port_conf_set_private(vtss_state_t           *vtss_state,
                                    const vtss_port_conf_t *const conf)
 {
     vtss_rc          rc;
+    vtss_prof_ctx_t  prof;
 #if defined(VTSS_FEATURE_AFI_SWC)
     BOOL             afi_link;
 #endif /* defined(VTSS_FEATURE_AFI_SWC) */
@@ -172,9 +176,11 @@ vtss_rc vtss_port_conf_set_private(vtss_state_t           *vtss_state,
     (void)VTSS_FUNC(afi.link_state_change, port_no, &afi_link);
 #endif /* defined(VTSS_FEATURE_AFI_SWC) */
 
+    vtss_cmn_prof_start(vtss_state, &prof);
     if ((rc = VTSS_FUNC_COLD(port.conf_set, port_no)) == VTSS_RC_OK) {
         vtss_state->port.conf_set_called[port_no] = TRUE;
     }
+    vtss_cmn_prof_end(vtss_state, &prof, "port_conf_set");
 
 #if defined(VTSS_FEATURE_AFI_SWC)
     // Resume AFI-generated frames on this port if it had link prior to calling
@@ -210,6 +216,96 @@ vtss_rc vtss_port_conf_set(const vtss_inst_t       inst,
     return rc;
 }
 
+vtss_rc vtss_port_conf_list_set(const vtss_inst_t       inst,
+                                const u32               cnt,
+                                const vtss_port_no_t    *const port_list,
+                                const vtss_port_conf_t  *const conf_list)
+{
+    vtss_state_t           *vtss_state;
+    vtss_rc                rc, rc2;
+    vtss_port_no_t         port_no, prep_port[VTSS_PORT_ARRAY_SIZE];
+    const vtss_port_conf_t *prep_conf[VTSS_PORT_ARRAY_SIZE];
+    BOOL                   member[VTSS_PORT_ARRAY_SIZE];
+    u32                    i, prep_cnt = 0;
+    vtss_prof_ctx_t        prof;
+#if defined(VTSS_FEATURE_AFI_SWC)
+    BOOL                   afi_link[VTSS_PORT_ARRAY_SIZE];
+#endif /* defined(VTSS_FEATURE_AFI_SWC) */
+
+    VTSS_I("cnt: %u", cnt);
+    VTSS_ENTER();
+    if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
+        VTSS_MEMSET(member, 0, sizeof(member));
+        for (i = 0; i < cnt; i++) {
+            port_no = port_list[i];
+            if (port_no >= vtss_state->port_count || member[port_no]) {
+                VTSS_E("illegal or duplicate port_no: %u", port_no);
+                rc = VTSS_RC_ERROR;
+                break;
+            }
+            member[port_no] = TRUE;
+            if (vtss_state->port.conf_set_called[port_no] &&
+                VTSS_MEMCMP(&vtss_state->port.conf[port_no], &conf_list[i], sizeof(conf_list[i])) == 0) {
+                // Not first time and conf hasn't changed. Nothing to do.
+                continue;
+            }
+            prep_port[prep_cnt] = port_no;
+            prep_conf[prep_cnt] = &conf_list[i];
+            prep_cnt++;
+        }
+    }
+    if (rc == VTSS_RC_OK && prep_cnt != 0) {
+#if defined(VTSS_FEATURE_AFI_SWC)
+        // Pause AFI-generated frames on all the ports before the prepare step
+        // starts flushing them, see vtss_port_conf_set_private()
+        for (i = 0; i < prep_cnt; i++) {
+            afi_link[i] = FALSE;
+            VTSS_I("Stopping AFI on port_no %u", prep_port[i]);
+            (void)VTSS_FUNC(afi.link_state_change, prep_port[i], &afi_link[i]);
+        }
+#endif /* defined(VTSS_FEATURE_AFI_SWC) */
+
+        // Issue the waiting phases of the bring-up for all ports at once
+        if (vtss_state->port.conf_list_prepare != NULL && !vtss_state->warm_start_cur) {
+            for (i = 0; i < prep_cnt; i++) {
+                if (!vtss_state->port.conf_set_called[prep_port[i]]) {
+                    // Set the port state down in H/W before preparing, see vtss_port_conf_set_private()
+                    (void)vtss_update_masks(vtss_state, 1, 0, 1);
+                    break;
+                }
+            }
+            // The prepare step works on the new configuration, which is also stored by vtss_port_conf_set_private()
+            for (i = 0; i < prep_cnt; i++) {
+                vtss_state->port.conf[prep_port[i]] = *prep_conf[i];
+            }
+            vtss_cmn_prof_start(vtss_state, &prof);
+            rc = vtss_state->port.conf_list_prepare(vtss_state, prep_cnt, prep_port, prep_conf);
+            vtss_cmn_prof_end(vtss_state, &prof, "port_conf_list_prepare");
+        }
+
+        // Complete the configuration port by port. All prepared ports must be
+        // configured, so an error does not stop the remaining ports.
+        for (i = 0; i < prep_cnt; i++) {
+            if ((rc2 = vtss_port_conf_set_private(vtss_state, prep_port[i], prep_conf[i])) != VTSS_RC_OK) {
+                VTSS_E("port_no: %u, conf set failed", prep_port[i]);
+                if (rc == VTSS_RC_OK) {
+                    rc = rc2;
+                }
+            }
+#if defined(VTSS_FEATURE_AFI_SWC)
+            // The AFI was paused above, so vtss_port_conf_set_private() does not resume it
+            if (afi_link[i]) {
+                VTSS_I("Resuming AFI on port_no %u", prep_port[i]);
+                (void)VTSS_FUNC(afi.link_state_change, prep_port[i], &afi_link[i]);
+            }
+#endif /* defined(VTSS_FEATURE_AFI_SWC) */
+        }
+    }
+    VTSS_EXIT();
+    VTSS_I("Exit(cnt = %u, changed = %u, rc = %d)", cnt, prep_cnt, rc);
+    return rc;
+}
+
 #if defined(VTSS_FEATURE_PORT_IFH)
 vtss_rc vtss_port_ifh_conf_set(const vtss_inst_t       inst,
                                const vtss_port_no_t    port_no,
@@ -667,6 +763,136 @@ vtss_rc vtss_miim_write(const vtss_inst_t            inst,
     return rc;
 }
 
+static vtss_rc vtss_miim_access_run(vtss_state_t *vtss_state, const u32 cnt, vtss_miim_access_t *const list)
+{
+    vtss_miim_access_t *access;
+    vtss_rc            rc = VTSS_RC_OK;
+    u32                i;
+
+    if (vtss_state->port.miim_access_list != NULL) {
+        return VTSS_FUNC(port.miim_access_list, cnt, list);
+    }
+
+    /* Fall back to single accesses */
+    for (i = 0; i < cnt; i++) {
+        access = &list[i];
+        if (access->write) {
+            access->rc = VTSS_FUNC(port.miim_write, access->miim_controller, access->miim_addr,
+                                   access->addr, access->value, FALSE);
+        } else {
+            access->rc = VTSS_FUNC(port.miim_read, access->miim_controller, access->miim_addr,
+                                   access->addr, &access->value, FALSE);
+        }
+        if (access->rc != VTSS_RC_OK) {
+            rc = VTSS_RC_ERROR;
+        }
+    }
+    return rc;
+}
+
+/* MII management access list - (direct - not via port map) */
+vtss_rc vtss_miim_access_list(const vtss_inst_t        inst,
+                              const vtss_chip_no_t     chip_no,
+                              const u32                cnt,
+                              vtss_miim_access_t *const list)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc = VTSS_RC_OK, rc_run;
+    u32          i, j, k;
+    BOOL         direct;
+
+    VTSS_RC(vtss_inst_chip_no_check(inst, &vtss_state, chip_no));
+
+    /* Consecutive accesses with the same locking are done in one run, keeping list order.
+       As for vtss_miim_read/write, the MIIM address bits outside VTSS_MIIM_ADDR_MASK select
+       direct access without lock */
+    for (i = 0; i < cnt; i = j) {
+        direct = ((list[i].miim_addr & VTSS_MIIM_ADDR_MASK) != list[i].miim_addr);
+        for (j = i; j < cnt && ((list[j].miim_addr & VTSS_MIIM_ADDR_MASK) != list[j].miim_addr) == direct; j++) {
+            list[j].miim_addr &= VTSS_MIIM_ADDR_MASK;
+        }
+        if (direct) {
+            rc_run = vtss_miim_access_run(vtss_state, j - i, &list[i]);
+            for (k = i; k < j; k++) {
+                list[k].miim_addr |= (u8)~VTSS_MIIM_ADDR_MASK;
+            }
+        } else {
+            VTSS_ENTER();
+            rc_run = vtss_miim_access_run(vtss_state, j - i, &list[i]);
+            VTSS_EXIT();
+        }
+        if (rc_run != VTSS_RC_OK) {
+            rc = rc_run;
+        }
+    }
+    return rc;
+}
+
+vtss_rc vtss_miim_scan_conf_get(const vtss_inst_t            inst,
+                                const vtss_chip_no_t         chip_no,
+                                const vtss_miim_controller_t miim_controller,
+                                vtss_miim_scan_conf_t        *const conf)
+{
+    vtss_state_t *vtss_state;
+
+    VTSS_RC(vtss_inst_chip_no_check(inst, &vtss_state, chip_no));
+    if (miim_controller < 0 || miim_controller >= VTSS_MIIM_CONTROLLERS) {
+        VTSS_E("illegal miim_controller: %d", miim_controller);
+        return VTSS_RC_ERROR;
+    }
+    VTSS_ENTER();
+    *conf = vtss_state->port.miim_scan[miim_controller];
+    VTSS_EXIT();
+    return VTSS_RC_OK;
+}
+
+vtss_rc vtss_miim_scan_conf_set(const vtss_inst_t            inst,
+                                const vtss_chip_no_t         chip_no,
+                                const vtss_miim_controller_t miim_controller,
+                                const vtss_miim_scan_conf_t  *const conf)
+{
+    vtss_state_t          *vtss_state;
+    vtss_miim_scan_conf_t *scan;
+    vtss_rc               rc;
+
+    VTSS_RC(vtss_inst_chip_no_check(inst, &vtss_state, chip_no));
+    if (miim_controller < 0 || miim_controller >= VTSS_MIIM_CONTROLLERS) {
+        VTSS_E("illegal miim_controller: %d", miim_controller);
+        return VTSS_RC_ERROR;
+    }
+    if (conf->miim_addr_low > conf->miim_addr_high || conf->miim_addr_high > 31 || conf->addr > 31) {
+        VTSS_E("illegal scan address range: %u-%u, addr: %u", conf->miim_addr_low, conf->miim_addr_high, conf->addr);
+        return VTSS_RC_ERROR;
+    }
+    VTSS_ENTER();
+    scan = &vtss_state->port.miim_scan[miim_controller];
+    *scan = *conf;
+    if ((rc = VTSS_FUNC(port.miim_scan_conf_set, miim_controller)) != VTSS_RC_OK) {
+        scan->enable = FALSE;
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
+vtss_rc vtss_miim_scan_status_get(const vtss_inst_t            inst,
+                                  const vtss_chip_no_t         chip_no,
+                                  const vtss_miim_controller_t miim_controller,
+                                  vtss_miim_scan_status_t      *const status)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc;
+
+    VTSS_RC(vtss_inst_chip_no_check(inst, &vtss_state, chip_no));
+    if (miim_controller < 0 || miim_controller >= VTSS_MIIM_CONTROLLERS) {
+        VTSS_E("illegal miim_controller: %d", miim_controller);
+        return VTSS_RC_ERROR;
+    }
+    VTSS_ENTER();
+    rc = VTSS_FUNC(port.miim_scan_status_get, miim_controller, status);
+    VTSS_EXIT();
+    return rc;
+}
+
 static vtss_rc vtss_mmd_check(vtss_state_t           *vtss_state,
                               vtss_port_no_t         port_no,
                               u8                     addr,
@@ -1305,6 +1531,33 @@ vtss_rc vtss_port_kr_irq_get(vtss_inst_t inst,
     return rc;
 }
 
+vtss_rc vtss_port_kr_irq_list_get(vtss_inst_t inst,
+                                  const u32 cnt,
+                                  const vtss_port_no_t *const port_list,
+                                  u32 *const irq_list)
+{
+    vtss_state_t *vtss_state;
+    vtss_rc      rc, rc2;
+    u32          i;
+
+    VTSS_D("cnt: %u", cnt);
+    VTSS_ENTER();
+    if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
+        for (i = 0; i < cnt; i++) {
+            // A failing port must not hold back the interrupts of the other ports
+            irq_list[i] = 0;
+            if ((rc2 = vtss_port_no_check(vtss_state, port_list[i])) == VTSS_RC_OK) {
+                rc2 = VTSS_FUNC_COLD(port.kr_irq_get, port_list[i], &irq_list[i]);
+            }
+            if (rc2 != VTSS_RC_OK && rc == VTSS_RC_OK) {
+                rc = rc2;
+            }
+        }
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
 vtss_rc vtss_port_kr_irq_activity(vtss_inst_t inst,
                                   u32 *const mask)
 {
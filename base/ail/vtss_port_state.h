@@ -464,6 +464,14 @@ typedef struct {
                            u8 addr,
                            u16 value,
                            BOOL report_errors);
+    vtss_rc (* miim_access_list)(struct vtss_state_s *vtss_state,
+                                 u32 cnt,
+                                 vtss_miim_access_t *list);
+    vtss_rc (* miim_scan_conf_set)(struct vtss_state_s *vtss_state,
+                                   vtss_miim_controller_t miim_controller);
+    vtss_rc (* miim_scan_status_get)(struct vtss_state_s *vtss_state,
+                                     vtss_miim_controller_t miim_controller,
+                                     vtss_miim_scan_status_t *status);
     vtss_rc (* mmd_read)(struct vtss_state_s *vtss_state,
                          vtss_miim_controller_t miim_controller, u8 miim_addr, u8 mmd,
                          u16 addr, u16 *value, BOOL report_errors);
@@ -478,6 +486,10 @@ typedef struct {
                          const vtss_port_no_t port_no,
                          vtss_port_conf_t *const conf);
     vtss_rc (* conf_set)(struct vtss_state_s *vtss_state, const vtss_port_no_t port_no);
+    vtss_rc (* conf_list_prepare)(struct vtss_state_s *vtss_state,
+                                  u32 cnt,
+                                  const vtss_port_no_t *const port_list,
+                                  const vtss_port_conf_t *const *conf_list);
 
     vtss_rc (* ifh_set)(struct vtss_state_s *vtss_state, const vtss_port_no_t port_no);
     vtss_rc (* clause_37_status_get)(struct vtss_state_s *vtss_state,
@@ -578,10 +590,19 @@ typedef struct {
     vtss_port_map_t               map[VTSS_PORT_ARRAY_SIZE];
     vtss_port_conf_t              conf[VTSS_PORT_ARRAY_SIZE];
     BOOL                          conf_set_called[VTSS_PORT_ARRAY_SIZE];
+    vtss_miim_scan_conf_t         miim_scan[VTSS_MIIM_CONTROLLERS];
+    BOOL                          miim_scan_suspended[VTSS_MIIM_CONTROLLERS]; /* Scanning stopped for direct accesses */
+    u32                           miim_scan_page_mask[VTSS_MIIM_CONTROLLERS]; /* Scanned PHYs with non-standard page */
     vtss_serdes_mode_t            sd6g40_mode[VTSS_SD6G_40_CNT];
 #if defined(VTSS_ARCH_SPARX5)
     vtss_serdes_mode_t            sd28_mode[VTSS_SD28_CNT];
     u32                           cmu_enable_mask;
+    u32                           cmu_cfg_mask;  /* CMUs configured, PLL reset pending */
+    u32                           cmu_pll_mask;  /* CMUs with PLL reset done, lock check pending */
+    u8                            flush_prepared[VTSS_PORT_ARRAY_SIZE]; /* Device with flush steps 1-6 done, see fa_port_flush() */
+    BOOL                          sd_prepared[VTSS_PORT_ARRAY_SIZE];    /* SerDes configured by fa_port_conf_list_prepare() */
+    u8                            wait_state[VTSS_PORT_ARRAY_SIZE];     /* Resumable status wait in progress */
+    vtss_mtimer_t                 wait_timer[VTSS_PORT_ARRAY_SIZE];     /* Resumable status wait deadline */
 #endif
     vtss_serdes_mode_t            serdes_mode[VTSS_PORT_ARRAY_SIZE];
     vtss_port_clause_37_control_t clause_37[VTSS_PORT_ARRAY_SIZE];
@@ -63,6 +63,7 @@ vtss_rc vtss_qos_conf_set(const vtss_inst_t      inst,
         /* Verify that prios is a power of two and not greater than prio_count (which must also be a power of two) */
         if ((prios != 0) &&  !(prios & (prios - 1)) && (prios <= vtss_state->qos.prio_count)) {
             changed = (vtss_state->qos.conf.prios != prios);
+            vtss_state->qos.conf_old = vtss_state->qos.conf;
             vtss_state->qos.conf = *conf;
             rc = VTSS_FUNC_COLD(qos.conf_set, changed);
         } else {
@@ -1167,6 +1168,7 @@ vtss_rc vtss_qos_restart_sync(vtss_state_t *vtss_state)
 
     for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
         vtss_state->qos.port_conf_old = vtss_state->qos.port_conf[port_no];
+        vtss_state->qos.port_conf_applied[port_no] = FALSE;
         VTSS_FUNC_RC(qos.port_conf_set, port_no);
     }
 
@@ -342,7 +342,7 @@ typedef struct {
     u32 next    : 14; /**< Index of next element in chain. A value equal to this element no. indicates this element is the end of the chain */
     u32 group   :  2; /**< Leak group that the element belongs to */
     u32 enabled :  1; /**< TRUE if entry is enabled */
-    u32 unused  :  1; /**< Currently unused */
+    u32 unlink  :  1; /**< TRUE if entry is waiting to be unlinked at the end of a batch */
 } vtss_qos_leak_entry_t;
 
 /** \brief Leak Group */
@@ -360,11 +360,14 @@ typedef struct {
     vtss_qos_leak_group_t group[VTSS_HSCH_LEAK_LISTS]; /**< Per group data */
     vtss_qos_leak_entry_t *entry;                      /**< Pointer to allocation for this layer */
     u16                   entries;                     /**< Number of entries in this layer */
+    u16                   unlinks;                     /**< Number of entries waiting to be unlinked */
 } vtss_qos_leak_layer_t;
 
 /** \brief Leak Config */
 typedef struct {
     vtss_qos_leak_layer_t layer[VTSS_HSCH_LAYERS];      /**< Per layer data */
+    u32                   batch;                        /**< Batch nesting level. Unlinks are deferred while non-zero */
+    u32                   batch_wait;                   /**< Longest leak period (nS) of groups with deferred unlinks */
     vtss_qos_leak_entry_t l0_alloc[VTSS_HSCH_L0_SES];   /**< Allocation of layer 0 entries. Only accessed through layer[0].entry above */
 //  vtss_qos_leak_entry_t l1_alloc[VTSS_HSCH_L1_SES];   /**< Allocation of layer 1 entries. Currently not used */
     vtss_qos_leak_entry_t l2_alloc[VTSS_HSCH_L2_SES];   /**< Allocation of layer 2 entries. Only accessed through layer[2].entry above */
@@ -458,6 +461,7 @@ typedef struct {
 } vtss_qos_lb_group_t;
 #define LB_GROUP_CNT   10   /* The number of LB groups */
 #define LB_SET_CNT   4615   /* The number of LB sets */
+#define LB_SET_WORDS ((LB_SET_CNT + 31) / 32) /* The number of 32-bit words in a LB set mask */
 #endif
 
 typedef struct {
@@ -533,7 +537,10 @@ typedef struct {
     BOOL                    wfq;
     vtss_prio_t             prio_count; /* Maximum number of supported priorities. Must be a power of two. Read-only! */
     vtss_qos_conf_t         conf;
+    vtss_qos_conf_t         conf_old;     /* Previous global configuration, used for delta updates */
+    BOOL                    conf_applied; /* Global configuration has been fully applied */
     vtss_qos_port_conf_t    port_conf_old;
+    BOOL                    port_conf_applied[VTSS_PORT_ARRAY_SIZE]; /* Port configuration has been fully applied */
     vtss_qos_port_conf_t    port_conf[VTSS_PORT_ARRAY_SIZE];
 #if defined(VTSS_ARCH_LUTON26)
     vtss_policer_user_t     policer_user[VTSS_L26_POLICER_CNT];
@@ -550,6 +557,7 @@ typedef struct {
 #if defined(VTSS_ARCH_SPARX5)
     vtss_qos_lb_group_t lb_groups[LB_GROUP_CNT];
     u16                 lb_set_grp_idx[LB_SET_CNT];     /* The LB group index for this LB set */
+    u32                 lb_set_mask[LB_GROUP_CNT][LB_SET_WORDS]; /* The LB sets in each LB group */
 #endif
 
 #if defined(VTSS_ARCH_OCELOT) || defined(VTSS_ARCH_LAN966X)
@@ -223,6 +223,40 @@ typedef struct {
 #endif
 } vtss_cil_func_t;
 
+/* ================================================================= *
+ *  Initialization profiling
+ * ================================================================= */
+
+#define VTSS_PROF_PHASES 48
+
+/* Accumulated time and register accesses of one phase */
+typedef struct {
+    const char *name;      /* Phase name */
+    u32        cnt;        /* Number of runs */
+    u64        usec;       /* Elapsed time */
+    u64        wait_usec;  /* Elapsed time not spent on the CPU (sleeping or waiting for I/O) */
+    u64        sleep_usec; /* Requested sleep time */
+    u32        reg_rd;     /* Register reads */
+    u32        reg_wr;     /* Register writes */
+} vtss_prof_phase_t;
+
+typedef struct {
+    u32               reg_rd;    /* Register reads, counted by the CIL */
+    u32               reg_wr;    /* Register writes, counted by the CIL */
+    u64               sleep_usec; /* Requested sleep time, see VTSS_PROF_MSLEEP() */
+    u32               phase_cnt; /* Number of phases used */
+    vtss_prof_phase_t phase[VTSS_PROF_PHASES];
+} vtss_prof_t;
+
+/* Phase start, see vtss_cmn_prof_start() */
+typedef struct {
+    u64 usec;
+    u64 cpu_usec;
+    u64 sleep_usec;
+    u32 reg_rd;
+    u32 reg_wr;
+} vtss_prof_ctx_t;
+
 /* ================================================================= *
  *  Total API state
  * ================================================================= */
@@ -245,8 +279,12 @@ typedef struct vtss_state_s {
     vtss_restart_t                restart_prev;    /* Previous restart configuration */
     vtss_version_t                version_cur;     /* Current version */
     vtss_version_t                version_prev;    /* Previous version */
+    BOOL                          sync_active;     /* Warm start synchronization in progress */
+    u32                           sync_entries;    /* Table entries checked by synchronization */
+    u32                           sync_changed;    /* Table entries written by synchronization */
 #endif /* VTSS_FEATURE_WARM_START */
     BOOL                          sync_calling_private; /* Used by PHY APIs */
+    vtss_prof_t                   prof;            /* Initialization profiling */
 
     u32                           chip_count;      /* Number of devices */
     vtss_chip_no_t                chip_no;         /* Currently selected device */
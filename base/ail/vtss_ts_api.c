@@ -938,11 +938,12 @@ vtss_rc vtss_tx_timestamp_update(const vtss_inst_t              inst)
 {
     vtss_state_t *vtss_state;
     vtss_rc rc;
-    u64 port_mask;
+    u64 pending;
     vtss_ts_timestamp_t ts;
     vtss_state_t *my_vtss_state;
-    int port_idx = 0;
-    int ts_idx = 0;
+    vtss_ts_timestamp_status_t *status;
+    u32 port_idx;
+    int ts_idx;
     void (*cb)(void *context, u32 port_no, vtss_ts_timestamp_t *ts);
     void *cx;
 
@@ -950,38 +951,36 @@ vtss_rc vtss_tx_timestamp_update(const vtss_inst_t              inst)
     if ((rc = vtss_inst_check(inst, &vtss_state)) == VTSS_RC_OK) {
         rc = VTSS_FUNC_0(ts.timestamp_get);
         VTSS_D("rc = %d", rc);
-        while ((port_idx < VTSS_PORT_ARRAY_SIZE) && (ts_idx < TS_IDS_RESERVED_FOR_SW)) {
-            if (vtss_state->ts.status[ts_idx].valid_mask != 0) {   /* We just check if any TS on this TS index */
-                port_mask = 1LL<<port_idx;
-                if ((vtss_state->ts.status[ts_idx].valid_mask & port_mask) && (vtss_state->ts.status[ts_idx].reserved_mask & port_mask)) {  /* There is a TS and this TS index is reserved */
-                    vtss_state->ts.status[ts_idx].valid_mask &= ~port_mask;
-                    vtss_state->ts.status[ts_idx].reserved_mask &= ~port_mask;
-                    ts.id = vtss_state->ts.status[ts_idx].tx_id[port_idx];
-                    ts.ts = vtss_state->ts.status[ts_idx].tx_tc[port_idx];
-                    ts.ts_valid = TRUE;
-                    if (vtss_state->ts.status[ts_idx].cb[port_idx] && vtss_state->ts.status[ts_idx].context[port_idx]) {
-                        my_vtss_state = vtss_state; /* save context */
-                        /* avoid using vtss_state while outside the API lock, as the API may be called from an other thread */
-                        cb = vtss_state->ts.status[ts_idx].cb[port_idx];
-                        cx = vtss_state->ts.status[ts_idx].context[port_idx];
-                        vtss_state->ts.status[ts_idx].cb[port_idx] = NULL;
-                        vtss_state->ts.status[ts_idx].context[port_idx] = NULL;
-                        VTSS_EXIT();
-                        /* call out of the API */
-                        cb(cx, port_idx, &ts);
-                        VTSS_ENTER();
-                        vtss_state = my_vtss_state; /* restore context */
-                    } else {
-                        VTSS_E("undefined TS callback port_idx %d, ts_idx %d", port_idx, ts_idx);
-                    }
-                    VTSS_D("port_no %d, ts_id %d, ts %" PRIu64 "(%d)", port_idx, ts.id, ts.ts, ts.ts_valid);
+        for (ts_idx = 0; ts_idx < TS_IDS_RESERVED_FOR_SW; ts_idx++) {
+            /* Only visit the ports having a valid TS on a reserved TS index. The masks are
+               re-read on each iteration, as the state may change while the callback runs */
+            while ((pending = (vtss_state->ts.status[ts_idx].valid_mask & vtss_state->ts.status[ts_idx].reserved_mask)) != 0) {
+                port_idx = VTSS_OS_CTZ64(pending);
+                if (port_idx >= VTSS_PORT_ARRAY_SIZE) {
+                    break;
                 }
-            } else {
-                port_idx = VTSS_PORT_ARRAY_SIZE;    /* No TS on this TS index - skip all ports */
-            }
-            if (++port_idx >= VTSS_PORT_ARRAY_SIZE) {
-                port_idx = 0;
-                ++ts_idx;
+                status = &vtss_state->ts.status[ts_idx];
+                status->valid_mask &= ~(1ULL << port_idx);
+                status->reserved_mask &= ~(1ULL << port_idx);
+                ts.id = status->tx_id[port_idx];
+                ts.ts = status->tx_tc[port_idx];
+                ts.ts_valid = TRUE;
+                if (status->cb[port_idx] && status->context[port_idx]) {
+                    my_vtss_state = vtss_state; /* save context */
+                    /* avoid using vtss_state while outside the API lock, as the API may be called from an other thread */
+                    cb = status->cb[port_idx];
+                    cx = status->context[port_idx];
+                    status->cb[port_idx] = NULL;
+                    status->context[port_idx] = NULL;
+                    VTSS_EXIT();
+                    /* call out of the API */
+                    cb(cx, port_idx, &ts);
+                    VTSS_ENTER();
+                    vtss_state = my_vtss_state; /* restore context */
+                } else {
+                    VTSS_E("undefined TS callback port_idx %u, ts_idx %d", port_idx, ts_idx);
+                }
+                VTSS_D("port_no %u, ts_id %d, ts %" PRIu64 "(%d)", port_idx, ts.id, ts.ts, ts.ts_valid);
             }
         }
     }
@@ -1092,7 +1091,8 @@ vtss_rc vtss_tx_timestamp_idx_alloc(const vtss_inst_t          inst,
                                    vtss_ts_id_t               *const ts_id)
 {
     vtss_state_t *vtss_state;
-    int port_idx = 0;
+    u32 port_idx;
+    u64 mask;
     vtss_rc rc = VTSS_RC_ERROR;
     u32 id;
 
@@ -1103,11 +1103,13 @@ vtss_rc vtss_tx_timestamp_idx_alloc(const vtss_inst_t          inst,
         for (id = 0; id < TS_IDS_RESERVED_FOR_SW; id++) {
             if ((vtss_state->ts.status[id].reserved_mask & alloc_parm->port_mask) == 0) {
                 vtss_state->ts.status[id].reserved_mask |= alloc_parm->port_mask;
-                for (port_idx = 0; port_idx < VTSS_PORT_ARRAY_SIZE; port_idx++) {
-                    if (alloc_parm->port_mask & (1LL<<port_idx)) {
-                        vtss_state->ts.status[id].context[port_idx] = alloc_parm->context;
-                        vtss_state->ts.status[id].cb[port_idx] = alloc_parm->cb;
+                /* Only visit the ports in the mask */
+                for (mask = alloc_parm->port_mask; mask != 0; mask &= (mask - 1)) {
+                    if ((port_idx = VTSS_OS_CTZ64(mask)) >= VTSS_PORT_ARRAY_SIZE) {
+                        break;
                     }
+                    vtss_state->ts.status[id].context[port_idx] = alloc_parm->context;
+                    vtss_state->ts.status[id].cb[port_idx] = alloc_parm->cb;
                 }
                 vtss_state->ts.status[id].age = 0;
                 ts_id->ts_id = id;
@@ -1168,37 +1170,34 @@ vtss_rc vtss_timestamp_age(const vtss_inst_t              inst)
         }
 
         VTSS_D("Aging timestamp ts_id = %d, reserved_mask = %" PRIx64 "", id, status->reserved_mask);
-        port_idx = 0;
-
-        while (status->reserved_mask && port_idx < VTSS_PORT_ARRAY_SIZE) {
-            port_mask = 1LL << port_idx;
 
-            if ((status->reserved_mask & port_mask)) {
-                status->reserved_mask &= ~port_mask;
-                ts.id = id;
-                ts.ts = 0;
-                ts.ts_valid = FALSE;
-                if (status->cb[port_idx] && status->context[port_idx]) {
-                    // Avoid using vtss_state while outside the API lock, as the
-                    // API may be called from an other thread
-                    my_vtss_state = vtss_state;
-                    cb = status->cb[port_idx];
-                    cx = status->context[port_idx];
-                    status->cb[port_idx] = NULL;
-                    status->context[port_idx] = NULL;
-                    VTSS_EXIT();
-                    // Call out of the API, to indicate timeout
-                    cb(cx, port_idx, &ts);
-                    VTSS_ENTER();
-                    vtss_state = my_vtss_state; /* restore context */
-                } else {
-                    VTSS_D("Undefined TS callback port_idx %d, ts_idx %d", port_idx, id);
-                }
-
-                VTSS_D("port_no %d, ts_id %d, ts %" PRIu64 "(%d)", port_idx, ts.id, ts.ts, ts.ts_valid);
+        /* Only visit the ports still having the TS index reserved */
+        while (status->reserved_mask &&
+               (port_idx = VTSS_OS_CTZ64(status->reserved_mask)) < VTSS_PORT_ARRAY_SIZE) {
+            port_mask = 1ULL << port_idx;
+
+            status->reserved_mask &= ~port_mask;
+            ts.id = id;
+            ts.ts = 0;
+            ts.ts_valid = FALSE;
+            if (status->cb[port_idx] && status->context[port_idx]) {
+                // Avoid using vtss_state while outside the API lock, as the
+                // API may be called from an other thread
+                my_vtss_state = vtss_state;
+                cb = status->cb[port_idx];
+                cx = status->context[port_idx];
+                status->cb[port_idx] = NULL;
+                status->context[port_idx] = NULL;
+                VTSS_EXIT();
+                // Call out of the API, to indicate timeout
+                cb(cx, port_idx, &ts);
+                VTSS_ENTER();
+                vtss_state = my_vtss_state; /* restore context */
+            } else {
+                VTSS_D("Undefined TS callback port_idx %d, ts_idx %d", port_idx, id);
             }
 
-            port_idx++;
+            VTSS_D("port_no %d, ts_id %d, ts %" PRIu64 "(%d)", port_idx, ts.id, ts.ts, ts.ts_valid);
         }
 
         status->reserved_mask = 0LL;
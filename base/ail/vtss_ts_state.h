@@ -22,6 +22,10 @@
 #define TS_PORT_ID_PORT_NUMBER_DEFAULT 0x9ABC
 #endif /* VTSS_ARCH_JAGUAR_2 */
 
+#if defined(VTSS_ARCH_SPARX5)
+#define VTSS_TS_CHIP_PORT_ARRAY_SIZE 65 /* Number of switch chip ports */
+#endif /* VTSS_ARCH_SPARX5 */
+
 typedef struct {
     vtss_ts_ext_clock_mode_t ext_clock_mode;
 #if defined(VTSS_ARCH_OCELOT) || defined(VTSS_ARCH_JAGUAR_2) || defined(VTSS_ARCH_SPARX5) || defined(VTSS_ARCH_LAN966X)
@@ -199,6 +203,9 @@ typedef struct {
     vtss_ts_internal_mode_t     int_mode;
     vtss_ts_port_conf_t         port_conf[VTSS_PORT_ARRAY_SIZE];
     vtss_ts_timestamp_status_t  status[VTSS_TS_ID_SIZE];
+#if defined(VTSS_ARCH_SPARX5)
+    vtss_port_no_t              chip_port_map[VTSS_TS_CHIP_PORT_ARRAY_SIZE]; /* Chip port to API port, used when draining the two-step FIFO */
+#endif /* VTSS_ARCH_SPARX5 */
 #if defined (VTSS_ARCH_OCELOT) && defined (VTSS_FEATURE_VOP)
     vtss_oam_timestamp_status_t oam_ts_status[VTSS_VOE_ID_SIZE];
 #endif /* VTSS_ARCH_OCELOT && VTSS_FEATURE_VOP */
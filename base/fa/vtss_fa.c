@@ -18,6 +18,7 @@ static inline vtss_rc reg_rd_direct(vtss_state_t *vtss_state, u32 reg, u32 *valu
         return vtss_fa_emul_rd(reg, value);
     }
 #endif
+    vtss_state->prof.reg_rd++;
     return vtss_state->init_conf.reg_read(0, reg, value);
 }
 
@@ -29,6 +30,7 @@ static inline vtss_rc reg_wr_direct(vtss_state_t *vtss_state, u32 reg, u32 value
         return vtss_fa_emul_wr(reg, value);
     }
 #endif
+    vtss_state->prof.reg_wr++;
     return vtss_state->init_conf.reg_write(0, reg, value);
 }
 
@@ -277,49 +279,60 @@ static vtss_rc fa_debug_info_print(vtss_state_t *vtss_state,
     return VTSS_RC_OK;
 }
 
+/* Run an init group, profiling all but the poll command */
+#define FA_INIT_GROUP(name, expr)                                               \
+{                                                                               \
+    if (cmd == VTSS_INIT_CMD_POLL) {                                            \
+        VTSS_RC(expr);                                                          \
+    } else {                                                                    \
+        VTSS_PROF_RC(cmd == VTSS_INIT_CMD_CREATE ? "create." name :             \
+                     cmd == VTSS_INIT_CMD_INIT ? "init." name : "port_map." name, expr); \
+    }                                                                           \
+}
+
 vtss_rc vtss_fa_init_groups(vtss_state_t *vtss_state, vtss_init_cmd_t cmd)
 {
     VTSS_N("Enter");
 
     /* Initialize ports */
-    VTSS_RC(vtss_fa_port_init(vtss_state, cmd));
+    FA_INIT_GROUP("port", vtss_fa_port_init(vtss_state, cmd));
 
     /* Initialize miscellaneous */
-    VTSS_RC(vtss_fa_misc_init(vtss_state, cmd));
+    FA_INIT_GROUP("misc", vtss_fa_misc_init(vtss_state, cmd));
 
     /* Initialize packet before L2 to ensure that VLAN table clear does not break VRAP access */
-    VTSS_RC(vtss_fa_packet_init(vtss_state, cmd));
+    FA_INIT_GROUP("packet", vtss_fa_packet_init(vtss_state, cmd));
 
 #if defined(VTSS_FEATURE_AFI_SWC) && defined(VTSS_AFI_V2)
-    VTSS_RC(vtss_fa_afi_init(vtss_state, cmd));
+    FA_INIT_GROUP("afi", vtss_fa_afi_init(vtss_state, cmd));
 #endif /* VTSS_FEATURE_AFI_SWC&& VTSS_AFI_V2 */
 
     /* Initialize L2 */
-    VTSS_RC(vtss_fa_l2_init(vtss_state, cmd));
+    FA_INIT_GROUP("l2", vtss_fa_l2_init(vtss_state, cmd));
 
 #if defined(VTSS_FEATURE_LAYER3)
     /* Initialize L3 */
-    VTSS_RC(vtss_fa_l3_init(vtss_state, cmd));
+    FA_INIT_GROUP("l3", vtss_fa_l3_init(vtss_state, cmd));
 #endif /* VTSS_FEATURE_LAYER3 */
 
 #if defined(VTSS_FEATURE_VCAP)
-    VTSS_RC(vtss_fa_vcap_init(vtss_state, cmd));
+    FA_INIT_GROUP("vcap", vtss_fa_vcap_init(vtss_state, cmd));
 #endif
 
 #if defined(VTSS_FEATURE_QOS)
-    VTSS_RC(vtss_fa_qos_init(vtss_state, cmd));
+    FA_INIT_GROUP("qos", vtss_fa_qos_init(vtss_state, cmd));
 #endif /* VTSS_FEATURE_QOS */
 
 #if defined(VTSS_FEATURE_TIMESTAMP)
-    VTSS_RC(vtss_fa_ts_init(vtss_state, cmd));
+    FA_INIT_GROUP("ts", vtss_fa_ts_init(vtss_state, cmd));
 #endif /* VTSS_FEATURE_TIMESTAMP */
 
 #if defined(VTSS_FEATURE_VOP)
-    VTSS_RC(vtss_fa_vop_init(vtss_state, cmd));
+    FA_INIT_GROUP("vop", vtss_fa_vop_init(vtss_state, cmd));
 #endif
 
 #if defined(VTSS_FEATURE_CLOCK)
-    VTSS_RC(vtss_es6514_clock_init(vtss_state, cmd));
+    FA_INIT_GROUP("clock", vtss_es6514_clock_init(vtss_state, cmd));
 #endif
 
     return VTSS_RC_OK;
@@ -599,18 +612,23 @@ static vtss_rc fa_init_switchcore(vtss_state_t *vtss_state)
 
 static vtss_rc fa_init_conf_set(vtss_state_t *vtss_state)
 {
-    u32 i;
+    u32             i;
+    vtss_prof_ctx_t prof;
 
     /* Initialize Switchcore and internal RAMs */
+    vtss_cmn_prof_start(vtss_state, &prof);
     if (fa_init_switchcore(vtss_state) != VTSS_RC_OK) {
         VTSS_E("Switchcore initialization error");
         return VTSS_RC_ERROR;
     }
+    vtss_cmn_prof_end(vtss_state, &prof, "init.switchcore");
 
     /* Initialize the LC-PLL (core clock) and set affected registers */
+    vtss_cmn_prof_start(vtss_state, &prof);
     if (fa_core_clock_config(vtss_state) != VTSS_RC_OK) {
          VTSS_E("LC-PLL initialization error");
     }
+    vtss_cmn_prof_end(vtss_state, &prof, "init.core_clock");
 
     /* Enable switch core and queue system */
     REG_WR(VTSS_HSCH_RESET_CFG, VTSS_F_HSCH_RESET_CFG_CORE_ENA(1));
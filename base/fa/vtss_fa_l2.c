@@ -511,19 +511,25 @@ static vtss_rc fa_vlan_conf_set(vtss_state_t *vtss_state)
     return VTSS_RC_OK;
 }
 
+static u32 fa_vlan_cfg_value(vtss_state_t *vtss_state, vtss_vid_t vid)
+{
+    vtss_vlan_entry_t *e = &vtss_state->l2.vlan_table[vid];
+
+    return (VTSS_F_ANA_L3_VLAN_CFG_VLAN_MSTP_PTR(e->msti) |
+            VTSS_F_ANA_L3_VLAN_CFG_VLAN_FID(e->fid == 0 ? vid : e->fid) |
+            VTSS_F_ANA_L3_VLAN_CFG_VLAN_IGR_FILTER_ENA(e->flags & VLAN_FLAGS_FILTER ? 1 : 0) |
+            VTSS_F_ANA_L3_VLAN_CFG_VLAN_FLOOD_DIS(e->flags & VLAN_FLAGS_FLOOD ? 0 : 1) |
+            VTSS_F_ANA_L3_VLAN_CFG_VLAN_LRN_DIS(e->flags & VLAN_FLAGS_LEARN ? 0 : 1) |
+            VTSS_F_ANA_L3_VLAN_CFG_VLAN_RLEG_ENA(e->rl_enable) |
+            VTSS_F_ANA_L3_VLAN_CFG_VLAN_PRIVATE_ENA(e->flags & VLAN_FLAGS_ISOLATED ? 1 : 0) |
+            VTSS_F_ANA_L3_VLAN_CFG_VLAN_MIRROR_ENA(e->flags & VLAN_FLAGS_MIRROR ? 1 : 0));
+}
+
 vtss_rc vtss_fa_vlan_update(vtss_state_t *vtss_state, vtss_vid_t vid)
 {
     vtss_vlan_entry_t *e = &vtss_state->l2.vlan_table[vid];
 
-    REG_WR(VTSS_ANA_L3_VLAN_CFG(vid),
-           VTSS_F_ANA_L3_VLAN_CFG_VLAN_MSTP_PTR(e->msti) |
-           VTSS_F_ANA_L3_VLAN_CFG_VLAN_FID(e->fid == 0 ? vid : e->fid) |
-           VTSS_F_ANA_L3_VLAN_CFG_VLAN_IGR_FILTER_ENA(e->flags & VLAN_FLAGS_FILTER ? 1 : 0) |
-           VTSS_F_ANA_L3_VLAN_CFG_VLAN_FLOOD_DIS(e->flags & VLAN_FLAGS_FLOOD ? 0 : 1) |
-           VTSS_F_ANA_L3_VLAN_CFG_VLAN_LRN_DIS(e->flags & VLAN_FLAGS_LEARN ? 0 : 1) |
-           VTSS_F_ANA_L3_VLAN_CFG_VLAN_RLEG_ENA(e->rl_enable) |
-           VTSS_F_ANA_L3_VLAN_CFG_VLAN_PRIVATE_ENA(e->flags & VLAN_FLAGS_ISOLATED ? 1 : 0) |
-           VTSS_F_ANA_L3_VLAN_CFG_VLAN_MIRROR_ENA(e->flags & VLAN_FLAGS_MIRROR ? 1 : 0));
+    REG_WR(VTSS_ANA_L3_VLAN_CFG(vid), fa_vlan_cfg_value(vtss_state, vid));
     REG_WR(VTSS_ANA_L3_VMID_CFG(vid), VTSS_F_ANA_L3_VMID_CFG_VMID(e->rl_id));
 
     return VTSS_RC_OK;
@@ -536,6 +542,26 @@ static vtss_rc fa_vlan_mask_update(vtss_state_t *vtss_state,
     vtss_port_mask_t pmask;
 
     vtss_port_mask_get(vtss_state, member, &pmask);
+
+#if defined(VTSS_FEATURE_WARM_START)
+    if (vtss_state->sync_active) {
+        /* Warm start synchronization: Skip entry if unchanged */
+        vtss_port_mask_t cur;
+        u32              value, vmid;
+        BOOL             changed;
+
+        REG_RDX_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG, vid, &cur);
+        REG_RD(VTSS_ANA_L3_VLAN_CFG(vid), &value);
+        REG_RD(VTSS_ANA_L3_VMID_CFG(vid), &vmid);
+        changed = (VTSS_MEMCMP(&cur, &pmask, sizeof(pmask)) != 0 ||
+                   value != fa_vlan_cfg_value(vtss_state, vid) ||
+                   vmid != VTSS_F_ANA_L3_VMID_CFG_VMID(vtss_state->l2.vlan_table[vid].rl_id));
+        if (!vtss_cmn_sync_changed(vtss_state, changed)) {
+            return VTSS_RC_OK;
+        }
+    }
+#endif /* VTSS_FEATURE_WARM_START */
+
     REG_WRX_PMASK(VTSS_ANA_L3_VLAN_MASK_CFG, vid, pmask);
 
     return vtss_fa_vlan_update(vtss_state, vid);
@@ -331,6 +331,49 @@ static vtss_rc fa_port_usxgmii_status_get(vtss_state_t *vtss_state,
 }
 
 
+/* Values of wait_state[]. The status functions must not sleep with the API lock held
+   while waiting for the hardware, so the waits are resumed by the next status poll.
+   Only the TN1395 aneg restart and the 100FX RX reset waits are resumable. While they are
+   pending, the status poll reports link down; there is no "in progress" return code and no
+   separate continuation call. The SerDes configuration and calibration waits (vtss_fa_serdes.c,
+   the sd10g28/sd25g28 setup and the port configuration in this file) are still blocking. */
+#define FA_PORT_WAIT_NONE         0
+#define FA_PORT_WAIT_ANEG_RESTART 1 /* TN1395: PCS restarted, aneg in progress */
+#define FA_PORT_WAIT_FX_RX_RST    2 /* 100FX: Serdes RX in reset */
+#define FA_PORT_WAIT_FX_RX_RUN    3 /* 100FX: Serdes RX released from reset */
+#define FA_PORT_WAIT_FX_CLEAR     4 /* 100FX: PCS stickies cleared */
+
+static void fa_port_wait_start(vtss_state_t *vtss_state, const vtss_port_no_t port_no, u8 state, u32 msec)
+{
+    vtss_state->port.wait_state[port_no] = state;
+    VTSS_MTIMER_START(&vtss_state->port.wait_timer[port_no], msec);
+}
+
+/* Returns TRUE if the port is waiting in 'state' and the wait has not expired */
+static BOOL fa_port_wait_pending(vtss_state_t *vtss_state, const vtss_port_no_t port_no, u8 state)
+{
+    if (vtss_state->port.wait_state[port_no] != state) {
+        return FALSE;
+    }
+    return VTSS_MTIMER_TIMEOUT(&vtss_state->port.wait_timer[port_no]) ? FALSE : TRUE;
+}
+
+/* Abandon a wait in progress, e.g. when the port is reconfigured */
+static vtss_rc fa_port_wait_cancel(vtss_state_t *vtss_state, const vtss_port_no_t port_no)
+{
+    u32 sd_lane_tgt;
+
+    if (vtss_state->port.wait_state[port_no] == FA_PORT_WAIT_FX_RX_RST) {
+        sd_lane_tgt = VTSS_TO_SD_LANE(vtss_fa_sd_lane_indx(vtss_state, port_no));
+        REG_WRM(VTSS_SD_LANE_TARGET_SD_LANE_CFG(sd_lane_tgt),
+                VTSS_F_SD_LANE_TARGET_SD_LANE_CFG_LANE_RX_RST(0),
+                VTSS_M_SD_LANE_TARGET_SD_LANE_CFG_LANE_RX_RST);
+    }
+    vtss_state->port.wait_state[port_no] = FA_PORT_WAIT_NONE;
+    VTSS_MTIMER_CANCEL(&vtss_state->port.wait_timer[port_no]);
+    return VTSS_RC_OK;
+}
+
 static vtss_rc fa_port_clause_37_status_get(vtss_state_t *vtss_state,
                                               const vtss_port_no_t         port_no,
                                               vtss_port_clause_37_status_t *const status)
@@ -382,14 +425,17 @@ static vtss_rc fa_port_clause_37_status_get(vtss_state_t *vtss_state,
 
     /* Workaround for a Serdes issue (TN1395), when aneg completes with FDX capability=0 */
     if (vtss_state->port.conf[port_no].if_type == VTSS_PORT_INTERFACE_SERDES) {
-        if (status->autoneg.complete) {
+        if (fa_port_wait_pending(vtss_state, port_no, FA_PORT_WAIT_ANEG_RESTART)) {
+            /* Aneg restart in progress, give it 50 msec */
+            status->autoneg.complete = 0;
+        } else if (status->autoneg.complete) {
+            vtss_state->port.wait_state[port_no] = FA_PORT_WAIT_NONE;
             if (((value >> 21) & 0x1) == 0) {
                 REG_WRM_CLR(VTSS_DEV1G_PCS1G_CFG(tgt), VTSS_M_DEV1G_PCS1G_CFG_PCS_ENA);
                 REG_WRM_SET(VTSS_DEV1G_PCS1G_CFG(tgt), VTSS_M_DEV1G_PCS1G_CFG_PCS_ENA);
                 (void)fa_port_clause_37_control_set(vtss_state, port_no);
-                VTSS_MSLEEP(50);
-                REG_RD(VTSS_DEV1G_PCS1G_ANEG_STATUS(tgt), &value);
-                status->autoneg.complete = REG_BF(DEV1G_PCS1G_ANEG_STATUS_ANEG_COMPLETE, value);
+                fa_port_wait_start(vtss_state, port_no, FA_PORT_WAIT_ANEG_RESTART, 50);
+                status->autoneg.complete = 0;
             }
         }
     }
@@ -408,15 +454,15 @@ static vtss_rc fa_port_clause_37_status_get(vtss_state_t *vtss_state,
     return VTSS_RC_OK;
 }
 
-static BOOL fa_change_device(vtss_state_t *vtss_state, vtss_port_no_t port_no) {
+static BOOL fa_conf_change_device(vtss_state_t *vtss_state, vtss_port_no_t port_no, const vtss_port_conf_t *conf) {
     u32 port = VTSS_CHIP_PORT(port_no);
 
     if (VTSS_PORT_IS_2G5(port)) {
         return FALSE; // This is the primary device
     }
 
-    if ((((vtss_state->port.current_speed[port_no] <= VTSS_SPEED_2500M) && (vtss_state->port.conf[port_no].speed > VTSS_SPEED_2500M))) ||
-       ((vtss_state->port.current_speed[port_no] > VTSS_SPEED_2500M) && (vtss_state->port.conf[port_no].speed <= VTSS_SPEED_2500M)) ||
+    if ((((vtss_state->port.current_speed[port_no] <= VTSS_SPEED_2500M) && (conf->speed > VTSS_SPEED_2500M))) ||
+       ((vtss_state->port.current_speed[port_no] > VTSS_SPEED_2500M) && (conf->speed <= VTSS_SPEED_2500M)) ||
        (vtss_state->port.current_speed[port_no] == VTSS_SPEED_UNDEFINED)) {
         return TRUE;
     } else {
@@ -424,12 +470,20 @@ static BOOL fa_change_device(vtss_state_t *vtss_state, vtss_port_no_t port_no) {
     }
 }
 
-static BOOL fa_is_high_speed_device(vtss_state_t *vtss_state, vtss_port_no_t port_no) {
-    if (vtss_state->port.conf[port_no].if_type == VTSS_PORT_INTERFACE_SXGMII ||
-        vtss_state->port.conf[port_no].if_type == VTSS_PORT_INTERFACE_DXGMII_10G) {
+static BOOL fa_change_device(vtss_state_t *vtss_state, vtss_port_no_t port_no) {
+    return fa_conf_change_device(vtss_state, port_no, &vtss_state->port.conf[port_no]);
+}
+
+static BOOL fa_conf_is_high_speed(const vtss_port_conf_t *conf) {
+    if (conf->if_type == VTSS_PORT_INTERFACE_SXGMII ||
+        conf->if_type == VTSS_PORT_INTERFACE_DXGMII_10G) {
        return TRUE;
     }
-    return vtss_state->port.conf[port_no].speed > VTSS_SPEED_2500M ? TRUE : FALSE;
+    return conf->speed > VTSS_SPEED_2500M ? TRUE : FALSE;
+}
+
+static BOOL fa_is_high_speed_device(vtss_state_t *vtss_state, vtss_port_no_t port_no) {
+    return fa_conf_is_high_speed(&vtss_state->port.conf[port_no]);
 }
 
 BOOL vtss_fa_port_is_high_speed(vtss_state_t *vtss_state, u32 port)
@@ -630,35 +684,178 @@ static vtss_rc fa_synce_clock_in_set(vtss_state_t *vtss_state, const vtss_synce_
 #define PHY_CMD_READ_INC 2 /* 1G: Read, 10G: Read and increment */
 #define PHY_CMD_READ     3 /* 10G: Read */
 
-static vtss_rc fa_miim_cmd(vtss_state_t *vtss_state,
-                            u32 cmd, u32 sof, vtss_miim_controller_t miim_controller,
-                            u8 miim_addr, u8 addr, u16 *data, BOOL report_errors)
+static vtss_rc fa_miim_idx_get(vtss_miim_controller_t miim_controller, u32 *idx)
 {
-    u32 i, n;
-    u32 value;
-
     switch (miim_controller) {
     case VTSS_MIIM_CONTROLLER_0:
-        i = 0;
+        *idx = 0;
         break;
     case VTSS_MIIM_CONTROLLER_1:
-        i = 1;
+        *idx = 1;
         break;
     case VTSS_MIIM_CONTROLLER_2:
-        i = 2;
+        *idx = 2;
         break;
     case VTSS_MIIM_CONTROLLER_3:
-        i = 3;
+        *idx = 3;
         break;
     default:
         VTSS_E("illegal miim_controller: %d", miim_controller);
         return VTSS_RC_ERROR;
     }
+    return VTSS_RC_OK;
+}
 
+static vtss_rc fa_miim_sof_set(vtss_state_t *vtss_state, u32 i, u32 sof)
+{
     /* Set Start of frame field */
     REG_WR(VTSS_DEVCPU_GCB_MII_CFG(i),
            VTSS_F_DEVCPU_GCB_MII_CFG_MIIM_CFG_PRESCALE(0x32) |
            VTSS_F_DEVCPU_GCB_MII_CFG_MIIM_ST_CFG_FIELD(sof));
+    return VTSS_RC_OK;
+}
+
+static vtss_rc fa_miim_start(vtss_state_t *vtss_state, u32 i, u32 cmd, u8 miim_addr, u8 addr, u16 data)
+{
+    REG_WR(VTSS_DEVCPU_GCB_MII_CMD(i),
+           VTSS_M_DEVCPU_GCB_MII_CMD_MIIM_CMD_VLD |
+           VTSS_F_DEVCPU_GCB_MII_CMD_MIIM_CMD_PHYAD(miim_addr) |
+           VTSS_F_DEVCPU_GCB_MII_CMD_MIIM_CMD_REGAD(addr) |
+           VTSS_F_DEVCPU_GCB_MII_CMD_MIIM_CMD_WRDATA(data) |
+           VTSS_F_DEVCPU_GCB_MII_CMD_MIIM_CMD_OPR_FIELD(cmd));
+    return VTSS_RC_OK;
+}
+
+static vtss_rc fa_miim_pending(vtss_state_t *vtss_state, u32 i, BOOL *pending)
+{
+    u32 value;
+
+    REG_RD(VTSS_DEVCPU_GCB_MII_STATUS(i), &value);
+    *pending = ((value & (VTSS_M_DEVCPU_GCB_MII_STATUS_MIIM_STAT_PENDING_RD |
+                          VTSS_M_DEVCPU_GCB_MII_STATUS_MIIM_STAT_PENDING_WR)) != 0);
+    return VTSS_RC_OK;
+}
+
+static vtss_rc fa_miim_data(vtss_state_t *vtss_state, u32 i, u16 *data)
+{
+    u32 value;
+
+    REG_RD(VTSS_DEVCPU_GCB_MII_DATA(i), &value);
+    if (value & VTSS_M_DEVCPU_GCB_MII_DATA_MIIM_DATA_SUCCESS) {
+        return VTSS_RC_ERROR;
+    }
+    *data = VTSS_X_DEVCPU_GCB_MII_DATA_MIIM_DATA_RDDATA(value);
+    return VTSS_RC_OK;
+}
+
+/* Stop automatic scanning while doing direct accesses */
+static vtss_rc fa_miim_scan_suspend(vtss_state_t *vtss_state, u32 i)
+{
+    u32 value, n;
+
+    if (!vtss_state->port.miim_scan[i].enable || vtss_state->port.miim_scan_suspended[i]) {
+        return VTSS_RC_OK;
+    }
+    vtss_state->port.miim_scan_suspended[i] = TRUE;
+    REG_WR(VTSS_DEVCPU_GCB_MII_CMD(i), 0);
+    for (n = 0; ; n++) {
+        REG_RD(VTSS_DEVCPU_GCB_MII_STATUS(i), &value);
+        if ((value & VTSS_M_DEVCPU_GCB_MII_STATUS_MIIM_STAT_BUSY) == 0) {
+            break;
+        }
+        if (n == 1000) {
+            VTSS_E("miim scan stop failed, miim_controller: %u", i);
+            return VTSS_RC_ERROR;
+        }
+    }
+    return VTSS_RC_OK;
+}
+
+/* Track Clause 22 page register writes to the scanned PHYs */
+static void fa_miim_scan_page_update(vtss_state_t *vtss_state, u32 i, u8 miim_addr, u8 addr, u16 value)
+{
+    vtss_miim_scan_conf_t *scan = &vtss_state->port.miim_scan[i];
+
+    if (addr != 31 || miim_addr < scan->miim_addr_low || miim_addr > scan->miim_addr_high) {
+        return;
+    }
+    if (value == 0) {
+        /* Page 0 is assumed to be the standard page */
+        vtss_state->port.miim_scan_page_mask[i] &= ~VTSS_BIT(miim_addr);
+    } else {
+        vtss_state->port.miim_scan_page_mask[i] |= VTSS_BIT(miim_addr);
+    }
+}
+
+/* (Re)start automatic scanning, which is started by a Clause 22 read operation.
+   While a scanned PHY is on a non-standard page, the scanned register is not valid and
+   scanning stays suspended */
+static vtss_rc fa_miim_scan_resume(vtss_state_t *vtss_state, u32 i)
+{
+    vtss_miim_scan_conf_t *scan = &vtss_state->port.miim_scan[i];
+
+    if (!scan->enable || vtss_state->port.miim_scan_page_mask[i] != 0) {
+        return VTSS_RC_OK;
+    }
+    vtss_state->port.miim_scan_suspended[i] = FALSE;
+    VTSS_RC(fa_miim_sof_set(vtss_state, i, 1));
+    REG_WR(VTSS_DEVCPU_GCB_MII_CMD(i),
+           VTSS_M_DEVCPU_GCB_MII_CMD_MIIM_CMD_VLD |
+           VTSS_F_DEVCPU_GCB_MII_CMD_MIIM_CMD_REGAD(scan->addr) |
+           VTSS_F_DEVCPU_GCB_MII_CMD_MIIM_CMD_OPR_FIELD(PHY_CMD_READ_INC) |
+           VTSS_M_DEVCPU_GCB_MII_CMD_MIIM_CMD_SCAN);
+    return VTSS_RC_OK;
+}
+
+static vtss_rc fa_miim_scan_conf_set(vtss_state_t *vtss_state, vtss_miim_controller_t miim_controller)
+{
+    vtss_miim_scan_conf_t *scan;
+    u32                   i;
+
+    VTSS_RC(fa_miim_idx_get(miim_controller, &i));
+    scan = &vtss_state->port.miim_scan[i];
+
+    /* Page writes are only tracked while scanning, so the PHYs are assumed to be on the standard page */
+    vtss_state->port.miim_scan_page_mask[i] = 0;
+
+    /* Scanning must be disabled while configuring the controller */
+    vtss_state->port.miim_scan_suspended[i] = TRUE;
+    REG_WR(VTSS_DEVCPU_GCB_MII_CMD(i), 0);
+    REG_WR(VTSS_DEVCPU_GCB_MII_SCAN_0(i),
+           VTSS_F_DEVCPU_GCB_MII_SCAN_0_MIIM_SCAN_PHYADHI(scan->miim_addr_high) |
+           VTSS_F_DEVCPU_GCB_MII_SCAN_0_MIIM_SCAN_PHYADLO(scan->miim_addr_low));
+    REG_WR(VTSS_DEVCPU_GCB_MII_SCAN_1(i),
+           VTSS_F_DEVCPU_GCB_MII_SCAN_1_MIIM_SCAN_MASK(scan->mask) |
+           VTSS_F_DEVCPU_GCB_MII_SCAN_1_MIIM_SCAN_EXPECT(scan->expect));
+    return fa_miim_scan_resume(vtss_state, i);
+}
+
+static vtss_rc fa_miim_scan_status_get(vtss_state_t *vtss_state,
+                                       vtss_miim_controller_t miim_controller,
+                                       vtss_miim_scan_status_t *status)
+{
+    u32 i, value;
+
+    VTSS_RC(fa_miim_idx_get(miim_controller, &i));
+    REG_RD(VTSS_DEVCPU_GCB_MII_SCAN_LAST_RSLTS_VLD(i), &status->valid);
+    REG_RD(VTSS_DEVCPU_GCB_MII_SCAN_LAST_RSLTS(i), &status->match);
+    /* Sticky bits are cleared to 'match' by reading */
+    REG_RD(VTSS_DEVCPU_GCB_MII_SCAN_RSLTS_STICKY(i), &value);
+    status->mismatch = ~value;
+    if (!vtss_state->port.miim_scan[i].enable || vtss_state->port.miim_scan_suspended[i]) {
+        status->valid = 0;
+    }
+    return VTSS_RC_OK;
+}
+
+static vtss_rc fa_miim_cmd_exec(vtss_state_t *vtss_state,
+                                u32 cmd, u32 sof, u32 i, vtss_miim_controller_t miim_controller,
+                                u8 miim_addr, u8 addr, u16 *data, BOOL report_errors)
+{
+    u32  n;
+    BOOL pending;
+
+    VTSS_RC(fa_miim_sof_set(vtss_state, i, sof));
 
     /* Read command is different for Clause 22 */
     if (sof == 1 && cmd == PHY_CMD_READ) {
@@ -666,18 +863,12 @@ static vtss_rc fa_miim_cmd(vtss_state_t *vtss_state,
     }
 
     /* Start command */
-    REG_WR(VTSS_DEVCPU_GCB_MII_CMD(i),
-           VTSS_M_DEVCPU_GCB_MII_CMD_MIIM_CMD_VLD |
-           VTSS_F_DEVCPU_GCB_MII_CMD_MIIM_CMD_PHYAD(miim_addr) |
-           VTSS_F_DEVCPU_GCB_MII_CMD_MIIM_CMD_REGAD(addr) |
-           VTSS_F_DEVCPU_GCB_MII_CMD_MIIM_CMD_WRDATA(*data) |
-           VTSS_F_DEVCPU_GCB_MII_CMD_MIIM_CMD_OPR_FIELD(cmd));
+    VTSS_RC(fa_miim_start(vtss_state, i, cmd, miim_addr, addr, *data));
 
     /* Wait for access to complete */
     for (n = 0; ; n++) {
-        REG_RD(VTSS_DEVCPU_GCB_MII_STATUS(i), &value);
-        if ((value & (VTSS_M_DEVCPU_GCB_MII_STATUS_MIIM_STAT_PENDING_RD |
-                      VTSS_M_DEVCPU_GCB_MII_STATUS_MIIM_STAT_PENDING_WR)) == 0) {
+        VTSS_RC(fa_miim_pending(vtss_state, i, &pending));
+        if (!pending) {
             break;
         }
         if (n == 1000) {
@@ -686,12 +877,8 @@ static vtss_rc fa_miim_cmd(vtss_state_t *vtss_state,
     }
 
     /* Read data */
-    if (cmd == PHY_CMD_READ || cmd == PHY_CMD_READ_INC) {
-        REG_RD(VTSS_DEVCPU_GCB_MII_DATA(i), &value);
-        if (value & VTSS_M_DEVCPU_GCB_MII_DATA_MIIM_DATA_SUCCESS) {
-            goto mmd_error;
-        }
-        *data = VTSS_X_DEVCPU_GCB_MII_DATA_MIIM_DATA_RDDATA(value);
+    if ((cmd == PHY_CMD_READ || cmd == PHY_CMD_READ_INC) && fa_miim_data(vtss_state, i, data) != VTSS_RC_OK) {
+        goto mmd_error;
     }
 
     return VTSS_RC_OK;
@@ -707,6 +894,150 @@ mmd_error:
     return VTSS_RC_ERROR;
 }
 
+static vtss_rc fa_miim_cmd(vtss_state_t *vtss_state,
+                            u32 cmd, u32 sof, vtss_miim_controller_t miim_controller,
+                            u8 miim_addr, u8 addr, u16 *data, BOOL report_errors)
+{
+    vtss_rc rc;
+    u32     i;
+
+    VTSS_RC(fa_miim_idx_get(miim_controller, &i));
+    if (!vtss_state->port.miim_scan[i].enable) {
+        /* No scanning on this controller */
+        return fa_miim_cmd_exec(vtss_state, cmd, sof, i, miim_controller, miim_addr, addr, data, report_errors);
+    }
+
+    /* While a PHY page is selected, scanning stays suspended across the accesses */
+    VTSS_RC(fa_miim_scan_suspend(vtss_state, i));
+    rc = fa_miim_cmd_exec(vtss_state, cmd, sof, i, miim_controller, miim_addr, addr, data, report_errors);
+    if (rc == VTSS_RC_OK && sof == 1 && cmd == PHY_CMD_WRITE) {
+        fa_miim_scan_page_update(vtss_state, i, miim_addr, addr, *data);
+    }
+    VTSS_RC(fa_miim_scan_resume(vtss_state, i));
+    return rc;
+}
+
+#define FA_MIIM_CONTROLLERS 4
+
+/* Clause 22 access list. One access is in progress per controller at a time, so accesses
+   on different controllers overlap, while accesses on the same controller keep list order */
+static vtss_rc fa_miim_access_list(vtss_state_t *vtss_state, u32 cnt, vtss_miim_access_t *list)
+{
+    vtss_miim_access_t *access;
+    u32                i, j, done = 0, scan_mask = 0, next[FA_MIIM_CONTROLLERS], poll[FA_MIIM_CONTROLLERS];
+    BOOL               busy[FA_MIIM_CONTROLLERS], used[FA_MIIM_CONTROLLERS], pending;
+    vtss_rc            rc = VTSS_RC_OK, rc_reg = VTSS_RC_OK;
+
+    for (i = 0; i < FA_MIIM_CONTROLLERS; i++) {
+        next[i] = 0;
+        poll[i] = 0;
+        busy[i] = FALSE;
+        used[i] = FALSE;
+    }
+
+    /* Check controllers and setup Clause 22 start of frame */
+    for (j = 0; j < cnt; j++) {
+        access = &list[j];
+        access->rc = fa_miim_idx_get(access->miim_controller, &i);
+        if (access->rc != VTSS_RC_OK) {
+            rc = VTSS_RC_ERROR;
+            done++;
+        } else if (!used[i]) {
+            used[i] = TRUE;
+            scan_mask |= VTSS_BIT(i);
+            if ((rc_reg = fa_miim_scan_suspend(vtss_state, i)) != VTSS_RC_OK ||
+                (rc_reg = fa_miim_sof_set(vtss_state, i, 1)) != VTSS_RC_OK) {
+                goto resume;
+            }
+        }
+    }
+
+    while (done < cnt) {
+        for (i = 0; i < FA_MIIM_CONTROLLERS; i++) {
+            if (!used[i]) {
+                continue;
+            }
+            if (busy[i]) {
+                /* Check if the access in progress has completed */
+                access = &list[next[i]];
+                if ((rc_reg = fa_miim_pending(vtss_state, i, &pending)) != VTSS_RC_OK) {
+                    goto resume;
+                }
+                if (pending && poll[i]++ < 1000) {
+                    continue;
+                }
+                busy[i] = FALSE;
+                next[i]++;
+                done++;
+                if (pending) {
+                    /* The controller is stuck, fail the remaining accesses on it */
+                    VTSS_E("miim timeout, miim_addr: %u, addr: %u, miim_controller: %u",
+                           access->miim_addr, access->addr, access->miim_controller);
+                    access->rc = VTSS_RC_ERROR;
+                    for (j = next[i]; j < cnt; j++) {
+                        if (list[j].rc == VTSS_RC_OK && (u32)list[j].miim_controller == i) {
+                            list[j].rc = VTSS_RC_ERROR;
+                            done++;
+                        }
+                    }
+                    used[i] = FALSE;
+                    rc = VTSS_RC_ERROR;
+                    continue;
+                }
+                access->rc = (access->write ? VTSS_RC_OK : fa_miim_data(vtss_state, i, &access->value));
+                if (access->rc == VTSS_RC_OK && access->write) {
+                    fa_miim_scan_page_update(vtss_state, i, access->miim_addr, access->addr, access->value);
+                }
+                if (access->rc != VTSS_RC_OK) {
+                    VTSS_D("miim failed, miim_addr: %u, addr: %u, miim_controller: %u",
+                           access->miim_addr, access->addr, access->miim_controller);
+                    rc = VTSS_RC_ERROR;
+                }
+            }
+
+            /* Start next access on this controller */
+            for (j = next[i]; j < cnt; j++) {
+                access = &list[j];
+                if (access->rc == VTSS_RC_OK && (u32)access->miim_controller == i) {
+                    break;
+                }
+            }
+            next[i] = j;
+            if (j == cnt) {
+                used[i] = FALSE;
+                continue;
+            }
+            if ((rc_reg = fa_miim_start(vtss_state, i, access->write ? PHY_CMD_WRITE : PHY_CMD_READ_INC,
+                                        access->miim_addr, access->addr,
+                                        access->write ? access->value : 0)) != VTSS_RC_OK) {
+                goto resume;
+            }
+            busy[i] = TRUE;
+            poll[i] = 0;
+        }
+    }
+
+resume:
+    if (rc_reg != VTSS_RC_OK) {
+        /* Register access failed, the accesses not completed are failed */
+        for (j = 0; j < cnt; j++) {
+            access = &list[j];
+            if (access->rc == VTSS_RC_OK && fa_miim_idx_get(access->miim_controller, &i) == VTSS_RC_OK &&
+                j >= next[i]) {
+                access->rc = VTSS_RC_ERROR;
+            }
+        }
+    }
+
+    /* Scanning is resumed on all suspended controllers, also if register access failed */
+    for (i = 0; i < FA_MIIM_CONTROLLERS; i++) {
+        if ((scan_mask & VTSS_BIT(i)) && fa_miim_scan_resume(vtss_state, i) != VTSS_RC_OK) {
+            rc_reg = VTSS_RC_ERROR;
+        }
+    }
+    return (rc_reg == VTSS_RC_OK ? rc : rc_reg);
+}
+
 static vtss_rc fa_miim_read(vtss_state_t *vtss_state,
                               vtss_miim_controller_t miim_controller,
                               u8 miim_addr,
@@ -1843,7 +2174,7 @@ static vtss_rc fa_enable_usx_extender(vtss_state_t *vtss_state, const vtss_port_
                 VTSS_M_PORT_CONF_USXGMII_CFG_NUM_PORTS);
 
         REG_WRM(VTSS_PORT_CONF_USXGMII_ENA, VTSS_BIT(R), VTSS_BIT(R));
-        VTSS_MSLEEP(3);
+        VTSS_PROF_MSLEEP(3);
 
         /* The usx channel is ready, restart aneg for all 4 ports in the group */
         for (cnt = 0; cnt < 4; cnt++) {
@@ -1943,12 +2274,63 @@ static vtss_rc fa_port_mux_set(vtss_state_t *vtss_state, const vtss_port_no_t po
     return VTSS_RC_OK;
 }
 
-static vtss_rc fa_serdes_set(vtss_state_t *vtss_state, const vtss_port_no_t port_no, vtss_serdes_mode_t serdes_mode)
+/* Serdes mode used for the port configuration */
+static vtss_serdes_mode_t fa_serdes_mode_get(vtss_state_t *vtss_state, const vtss_port_no_t port_no)
+{
+    vtss_port_conf_t *conf = &vtss_state->port.conf[port_no];
+    BOOL             spd_2g5 = (conf->speed == VTSS_SPEED_2500M);
+
+    if (fa_is_high_speed_device(vtss_state, port_no)) {
+        switch (conf->if_type) {
+        case VTSS_PORT_INTERFACE_SXGMII:     return VTSS_SERDES_MODE_QXGMII;     // 1x10G device. 10M-10G.
+        case VTSS_PORT_INTERFACE_DXGMII_10G: return VTSS_SERDES_MODE_DXGMII_10G; // 2x5G devices. Mode 'U', 10M-5G.
+        default:                             return VTSS_SERDES_MODE_SFI;
+        }
+    }
+
+    switch (conf->if_type) {
+    case VTSS_PORT_INTERFACE_SERDES:
+    case VTSS_PORT_INTERFACE_VAUI:
+    case VTSS_PORT_INTERFACE_SGMII:
+    case VTSS_PORT_INTERFACE_SGMII_2G5:
+        return (spd_2g5 ? VTSS_SERDES_MODE_2G5 : VTSS_SERDES_MODE_SGMII);
+    case VTSS_PORT_INTERFACE_SGMII_CISCO:
+        if (vtss_state->port.serdes_mode[port_no] == VTSS_SERDES_MODE_QSGMII) {
+            return VTSS_SERDES_MODE_QSGMII; // Do not change the Serdes mode
+        }
+        return VTSS_SERDES_MODE_SGMII;
+    case VTSS_PORT_INTERFACE_100FX:      return VTSS_SERDES_MODE_100FX;
+    case VTSS_PORT_INTERFACE_QSGMII:     return VTSS_SERDES_MODE_QSGMII;     // Normal QSGMII
+    case VTSS_PORT_INTERFACE_USGMII:     return VTSS_SERDES_MODE_USGMII;     // 8x1G, X-mode (ala 2 x QSGMII) 10G Serdes
+    case VTSS_PORT_INTERFACE_QXGMII:     return VTSS_SERDES_MODE_QXGMII;     // 4x2G5 R-mode, 10G Serdes
+    case VTSS_PORT_INTERFACE_DXGMII_5G:  return VTSS_SERDES_MODE_DXGMII_5G;  // 2x2G5 F-mode, 5G Serdes
+    default:                             return VTSS_SERDES_MODE_SGMII;
+    }
+}
+
+/* Returns TRUE if the port configuration (re)configures the Serdes to 'serdes_mode' */
+static BOOL fa_serdes_conf_needed(vtss_state_t *vtss_state, const vtss_port_no_t port_no, vtss_serdes_mode_t serdes_mode)
+{
+    vtss_port_conf_t   *conf = &vtss_state->port.conf[port_no];
+    vtss_serdes_mode_t sd_mode = vtss_state->port.sd28_mode[vtss_fa_sd_lane_indx(vtss_state, port_no)];
+
+    if (conf->power_down) {
+        return FALSE;
+    }
+    if (sd_mode == VTSS_SERDES_MODE_DISABLE || sd_mode != serdes_mode) {
+        return TRUE;
+    }
+    /* See fa_port_conf_high_set() */
+    return (fa_is_high_speed_device(vtss_state, port_no) &&
+            (vtss_state->port.current_speed[port_no] != conf->speed ||
+             vtss_state->port.current_mt[port_no] != conf->serdes.media_type));
+}
+
+/* Store the Serdes mode after the Serdes configuration */
+static void fa_serdes_mode_store(vtss_state_t *vtss_state, const vtss_port_no_t port_no, vtss_serdes_mode_t serdes_mode)
 {
     u32 indx = vtss_fa_sd_lane_indx(vtss_state, port_no);
 
-    VTSS_RC(vtss_fa_sd_cfg(vtss_state, port_no, serdes_mode));
-    /* Store the serdes mode */
     vtss_state->port.sd28_mode[indx] = serdes_mode;
 
     /* Also update the port.serdes_mode[port_no] - for backward compatability */
@@ -1973,6 +2355,12 @@ static vtss_rc fa_serdes_set(vtss_state_t *vtss_state, const vtss_port_no_t port
     } else {
         vtss_state->port.serdes_mode[port_no] = serdes_mode;
     }
+}
+
+static vtss_rc fa_serdes_set(vtss_state_t *vtss_state, const vtss_port_no_t port_no, vtss_serdes_mode_t serdes_mode)
+{
+    VTSS_PROF_RC("serdes_cfg", vtss_fa_sd_cfg(vtss_state, port_no, serdes_mode));
+    fa_serdes_mode_store(vtss_state, port_no, serdes_mode);
     return VTSS_RC_OK;
 }
 
@@ -2224,21 +2612,31 @@ static vtss_rc fa_port_flush_poll(vtss_state_t *vtss_state, vtss_phys_port_no_t
             break;
         }
 
-        VTSS_MSLEEP(1);
+        VTSS_PROF_MSLEEP(1);
     }
 
     return VTSS_RC_OK;
 }
 
-/* Port disable and flush procedure */
-static vtss_rc fa_port_flush(vtss_state_t *vtss_state, const vtss_port_no_t port_no, BOOL high_speed_dev)
+/* Values of flush_prepared[] */
+#define FA_FLUSH_PREP_NONE 0
+#define FA_FLUSH_PREP_2G5  1
+#define FA_FLUSH_PREP_HIGH 2
+
+/* Worst case time for a frame in progress to drain (jumbo at the current speed) */
+static u32 fa_port_flush_wait_ns(vtss_state_t *vtss_state, const vtss_port_no_t port_no)
 {
-    u32 port = VTSS_CHIP_PORT(port_no);
-    u32 tgt = high_speed_dev ? VTSS_TO_HIGH_DEV(port) : VTSS_TO_DEV2G5(port);
     vtss_port_speed_t spd = vtss_state->port.current_speed[port_no];
     u32 spd_prm = spd == VTSS_SPEED_10M ? 1000 : spd == VTSS_SPEED_100M ? 100 : 10;
 
-    VTSS_I("Flush chip port: %u (%s device)", port, high_speed_dev ? "5/10/25G" : "2G5");
+    return 8000 * spd_prm;
+}
+
+/* Port flush steps 1-5: Stop reception and transmission on the port */
+static vtss_rc fa_port_flush_start(vtss_state_t *vtss_state, const vtss_port_no_t port_no, BOOL high_speed_dev)
+{
+    u32 port = VTSS_CHIP_PORT(port_no);
+    u32 tgt = high_speed_dev ? VTSS_TO_HIGH_DEV(port) : VTSS_TO_DEV2G5(port);
 
     if (high_speed_dev) {
         /* 1: Reset the PCS Rx clock domain  */
@@ -2272,8 +2670,29 @@ static vtss_rc fa_port_flush(vtss_state_t *vtss_state, const vtss_port_no_t port
     /* 5.1: Disable PFC */
     /* REG_WRM_CLR(VTSS_QRES_RES_QOS_ADV_PFC_CFG(port), VTSS_M_QRES_RES_QOS_ADV_PFC_CFG_TX_PFC_ENA); */
 
-    /* 6: Wait a worst case time 8ms (jumbo/10Mbit) *\/ */
-    VTSS_NSLEEP(8000 * spd_prm);
+    return VTSS_RC_OK;
+}
+
+/* Port disable and flush procedure */
+static vtss_rc fa_port_flush(vtss_state_t *vtss_state, const vtss_port_no_t port_no, BOOL high_speed_dev)
+{
+    u32 port = VTSS_CHIP_PORT(port_no);
+    u32 tgt = high_speed_dev ? VTSS_TO_HIGH_DEV(port) : VTSS_TO_DEV2G5(port);
+    u8  prepared = vtss_state->port.flush_prepared[port_no];
+
+    VTSS_I("Flush chip port: %u (%s device)", port, high_speed_dev ? "5/10/25G" : "2G5");
+
+    vtss_state->port.flush_prepared[port_no] = FA_FLUSH_PREP_NONE;
+    if (prepared == (high_speed_dev ? FA_FLUSH_PREP_HIGH : FA_FLUSH_PREP_2G5)) {
+        /* 1-6: Already done for this device by fa_port_conf_list_prepare() */
+        VTSS_D("Flush chip port: %u, steps 1-6 prepared", port);
+    } else {
+        /* 1-5: Stop the port */
+        VTSS_RC(fa_port_flush_start(vtss_state, port_no, high_speed_dev));
+
+        /* 6: Wait a worst case time 8ms (jumbo/10Mbit) *\/ */
+        VTSS_PROF_NSLEEP(fa_port_flush_wait_ns(vtss_state, port_no));
+    }
 
     /* 7: Flush the queues accociated with the port */
     REG_WRM(VTSS_HSCH_FLUSH_CTRL,
@@ -2395,7 +2814,7 @@ static vtss_rc fa_sd_power_save(vtss_state_t *vtss_state, const vtss_port_no_t p
 
         if (type == FA_SERDES_TYPE_25G) {
             DEV_WRM(DEV_RST_CTRL, port, VTSS_F_DEV10G_DEV_RST_CTRL_PCS_TX_RST(power_down), VTSS_M_DEV10G_DEV_RST_CTRL_PCS_TX_RST);
-            VTSS_MSLEEP(1);
+            VTSS_PROF_MSLEEP(1);
             REG_WRM(VTSS_SD25G_TARGET_LANE_04(sd_tgt),
                     VTSS_F_SD25G_TARGET_LANE_04_LN_CFG_PD_DRIVER(power_down),
                     VTSS_M_SD25G_TARGET_LANE_04_LN_CFG_PD_DRIVER);
@@ -2496,45 +2915,25 @@ static vtss_rc fa_port_conf_2g5_set(vtss_state_t *vtss_state, const vtss_port_no
     BOOL                   fdx = conf->fdx;
     BOOL                   sgmii = FALSE, pcs_100fx = FALSE, pcs_usx = FALSE;
     u32                    tgt = VTSS_TO_DEV2G5(port), clk_spd = 0;
-    vtss_serdes_mode_t     serdes_mode = VTSS_SERDES_MODE_SGMII;
+    vtss_serdes_mode_t     serdes_mode = fa_serdes_mode_get(vtss_state, port_no);
     u32                    sd_indx = vtss_fa_sd_lane_indx(vtss_state, port_no);
 
     switch (conf->if_type) {
     case VTSS_PORT_INTERFACE_SERDES:
     case VTSS_PORT_INTERFACE_VAUI:
-        serdes_mode = (speed == VTSS_SPEED_2500M ? VTSS_SERDES_MODE_2G5 : VTSS_SERDES_MODE_SGMII);
         break;
     case VTSS_PORT_INTERFACE_SGMII:
     case VTSS_PORT_INTERFACE_SGMII_2G5:
-        serdes_mode = (speed == VTSS_SPEED_2500M ? VTSS_SERDES_MODE_2G5 : VTSS_SERDES_MODE_SGMII);
-        sgmii = TRUE;
-        break;
     case VTSS_PORT_INTERFACE_SGMII_CISCO:
-        if (vtss_state->port.serdes_mode[port_no] == VTSS_SERDES_MODE_QSGMII) {
-            serdes_mode = VTSS_SERDES_MODE_QSGMII; // Do not change the Serdes mode
-        } else {
-            serdes_mode = VTSS_SERDES_MODE_SGMII;
-        }
+    case VTSS_PORT_INTERFACE_QSGMII:
+    case VTSS_PORT_INTERFACE_USGMII:
         sgmii = TRUE;
         break;
     case VTSS_PORT_INTERFACE_100FX:
-        serdes_mode = VTSS_SERDES_MODE_100FX;
         pcs_100fx = TRUE;
         break;
-    case VTSS_PORT_INTERFACE_QSGMII:    // Normal QSGMII
-        serdes_mode = VTSS_SERDES_MODE_QSGMII;
-        sgmii = TRUE;
-        break;
-    case VTSS_PORT_INTERFACE_USGMII:    // 8x1G, X-mode (ala 2 x QSGMII) 10G Serdes
-        serdes_mode = VTSS_SERDES_MODE_USGMII;
-        sgmii = TRUE;
-        break;
-    case VTSS_PORT_INTERFACE_QXGMII:    // 4x2G5 R-mode, 10G Serdes
-        serdes_mode = VTSS_SERDES_MODE_QXGMII;
-        pcs_usx = TRUE;
-        break;
-    case VTSS_PORT_INTERFACE_DXGMII_5G: // 2x2G5 F-mode, 5G Serdes
-        serdes_mode = VTSS_SERDES_MODE_DXGMII_5G;
+    case VTSS_PORT_INTERFACE_QXGMII:
+    case VTSS_PORT_INTERFACE_DXGMII_5G:
         pcs_usx = TRUE;
         break;
     default:{ VTSS_E("Interface type not supported"); }
@@ -2797,20 +3196,15 @@ static vtss_rc fa_port_conf_high_set(vtss_state_t *vtss_state, const vtss_port_n
     u32                    tgt = VTSS_TO_HIGH_DEV(port);
     u32                    pcs = VTSS_TO_PCS_TGT(port);
     u32                    clk_spd = 0, muxed_ports = 0;
-    vtss_serdes_mode_t     serdes_mode = VTSS_SERDES_MODE_SFI;
+    vtss_serdes_mode_t     serdes_mode = fa_serdes_mode_get(vtss_state, port_no);
     BOOL                   pcs_usx = FALSE;
     u32                    sd_indx = vtss_fa_sd_lane_indx(vtss_state, port_no);
 
     switch (conf->if_type) {
-    case VTSS_PORT_INTERFACE_SFI:
-        serdes_mode = VTSS_SERDES_MODE_SFI;
-        break;
     case VTSS_PORT_INTERFACE_SXGMII:     // 1x10G device. 10M-10G.
-        serdes_mode = VTSS_SERDES_MODE_QXGMII;
         pcs_usx = TRUE;
         break;
     case VTSS_PORT_INTERFACE_DXGMII_10G: // 2x5G devices. Mode 'U', 10M-5G.
-        serdes_mode = VTSS_SERDES_MODE_DXGMII_10G;
         muxed_ports = 1; // Dual
         pcs_usx = TRUE;
         break;
@@ -2836,10 +3230,11 @@ static vtss_rc fa_port_conf_high_set(vtss_state_t *vtss_state, const vtss_port_n
     } else {
         /* Port disable and flush procedure: */
         VTSS_RC(fa_port_flush(vtss_state, port_no, TRUE));
-        /* Re-configure Serdes if needed */
-        if (serdes_mode != vtss_state->port.sd28_mode[sd_indx] ||
-            vtss_state->port.current_speed[port_no] != conf->speed ||
-            vtss_state->port.current_mt[port_no] != conf->serdes.media_type) {
+        /* Re-configure Serdes if needed and not done by fa_port_conf_list_prepare() */
+        if (!vtss_state->port.sd_prepared[port_no] &&
+            (serdes_mode != vtss_state->port.sd28_mode[sd_indx] ||
+             vtss_state->port.current_speed[port_no] != conf->speed ||
+             vtss_state->port.current_mt[port_no] != conf->serdes.media_type)) {
             VTSS_RC(fa_serdes_set(vtss_state, port_no, serdes_mode));
         }
     }
@@ -2964,7 +3359,149 @@ static vtss_rc fa_port_conf_high_set(vtss_state_t *vtss_state, const vtss_port_n
 
 }
 
-static vtss_rc fa_port_conf_set(vtss_state_t *vtss_state, const vtss_port_no_t port_no)
+/* Start the port flush (steps 1-5) for the ports with 'prep' set to 'flush' and wait once for all of them to drain */
+static void fa_port_conf_list_flush(vtss_state_t *vtss_state,
+                                    u32 cnt,
+                                    const vtss_port_no_t *const port_list,
+                                    const u8 *prep,
+                                    const u8 *flush)
+{
+    vtss_port_no_t port_no;
+    u32            i, wait_ns = 0, prep_cnt = 0;
+
+    for (i = 0; i < cnt; i++) {
+        port_no = port_list[i];
+        if (prep[i] == FA_FLUSH_PREP_NONE || !flush[i]) {
+            continue;
+        }
+        if (fa_port_flush_start(vtss_state, port_no, prep[i] == FA_FLUSH_PREP_HIGH) != VTSS_RC_OK) {
+            continue; /* Steps 1-5 are done again by fa_port_flush() */
+        }
+        vtss_state->port.flush_prepared[port_no] = prep[i];
+        wait_ns = MAX(wait_ns, fa_port_flush_wait_ns(vtss_state, port_no));
+        prep_cnt++;
+    }
+
+    if (prep_cnt != 0) {
+        /* 6: Wait a worst case time for all ports */
+        VTSS_I("Flush prepared for %u ports, wait %u ns", prep_cnt, wait_ns);
+        VTSS_PROF_NSLEEP(wait_ns);
+    }
+}
+
+/* Set up the Serdes of the ports with 'sd_mode' set, one stage at a time for all ports with one wait per stage */
+static void fa_port_conf_list_serdes(vtss_state_t *vtss_state,
+                                     u32 cnt,
+                                     const vtss_port_no_t *const port_list,
+                                     const vtss_serdes_mode_t *sd_mode)
+{
+    vtss_port_no_t  port_no;
+    u32             i, stage, wait_msec, stage_wait, sd_cnt = 0;
+    BOOL            sd_ok[VTSS_PORT_ARRAY_SIZE];
+    vtss_prof_ctx_t prof;
+
+    vtss_cmn_prof_start(vtss_state, &prof);
+    for (i = 0; i < cnt; i++) {
+        sd_ok[i] = (sd_mode[i] != VTSS_SERDES_MODE_DISABLE);
+    }
+    for (stage = 0; stage < FA_SD_SETUP_STAGES; stage++) {
+        stage_wait = 0;
+        for (i = 0; i < cnt; i++) {
+            if (!sd_ok[i]) {
+                continue;
+            }
+            port_no = port_list[i];
+            if (vtss_fa_sd_cfg_stage(vtss_state, port_no, sd_mode[i], stage, &wait_msec) != VTSS_RC_OK) {
+                /* The port configuration will set up the Serdes again and report the error */
+                VTSS_I("port_no: %u, Serdes stage %u failed", port_no, stage);
+                sd_ok[i] = FALSE;
+                continue;
+            }
+            stage_wait = MAX(stage_wait, wait_msec);
+        }
+        if (stage_wait != 0) {
+            VTSS_PROF_MSLEEP(stage_wait);
+        }
+    }
+    for (i = 0; i < cnt; i++) {
+        if (sd_ok[i]) {
+            port_no = port_list[i];
+            fa_serdes_mode_store(vtss_state, port_no, sd_mode[i]);
+            vtss_state->port.sd_prepared[port_no] = TRUE;
+            sd_cnt++;
+        }
+    }
+    VTSS_I("Serdes set up for %u ports", sd_cnt);
+    vtss_cmn_prof_end(vtss_state, &prof, "serdes_cfg_list");
+}
+
+/* Issue the waiting phases of the port configuration across a list of ports, with one wait per phase.
+   The new configuration has been stored in port.conf[] by the caller.
+   - Ports whose device is flushed before the Serdes setup in fa_port_conf_set() start the flush (steps 1-6).
+   - The Serdes of all ports are set up stage by stage, see vtss_fa_sd_cfg_stage().
+   - Ports whose device gets its Serdes clock from that setup then start the flush.
+   The remaining flush steps and the rest of the configuration are done port by port by fa_port_conf_set(). */
+static vtss_rc fa_port_conf_list_prepare(vtss_state_t *vtss_state,
+                                         u32 cnt,
+                                         const vtss_port_no_t *const port_list,
+                                         const vtss_port_conf_t *const *conf_list)
+{
+    const vtss_port_conf_t *conf;
+    vtss_port_no_t         port_no;
+    u32                    i, sd_indx, k;
+    BOOL                   high_speed_dev, change_dev, sd_disabled;
+    u8                     prep[VTSS_PORT_ARRAY_SIZE];
+    u8                     flush_early[VTSS_PORT_ARRAY_SIZE], flush_late[VTSS_PORT_ARRAY_SIZE];
+    vtss_serdes_mode_t     sd_mode[VTSS_PORT_ARRAY_SIZE], serdes_mode;
+
+    for (i = 0; i < cnt; i++) {
+        port_no = port_list[i];
+        conf = conf_list[i];
+        prep[i] = FA_FLUSH_PREP_NONE;
+        flush_early[i] = FALSE;
+        flush_late[i] = FALSE;
+        sd_mode[i] = VTSS_SERDES_MODE_DISABLE;
+        if (!fa_vrfy_spd_iface(vtss_state, port_no, conf->if_type, conf->speed, conf->fdx)) {
+            continue; /* Rejected by fa_port_conf_set() */
+        }
+        sd_indx = vtss_fa_sd_lane_indx(vtss_state, port_no);
+        sd_disabled = (vtss_state->port.sd28_mode[sd_indx] == VTSS_SERDES_MODE_DISABLE);
+
+        /* The Serdes is set up once per lane, other ports on the lane are handled by fa_port_conf_set() */
+        serdes_mode = fa_serdes_mode_get(vtss_state, port_no);
+        if (fa_serdes_conf_needed(vtss_state, port_no, serdes_mode)) {
+            for (k = 0; k < i; k++) {
+                if (sd_mode[k] != VTSS_SERDES_MODE_DISABLE && vtss_fa_sd_lane_indx(vtss_state, port_list[k]) == sd_indx) {
+                    break;
+                }
+            }
+            if (k == i) {
+                sd_mode[i] = serdes_mode;
+            }
+        }
+
+        /* The first flush done by fa_port_conf_set() is the old device if the device changes, otherwise the new device */
+        high_speed_dev = fa_conf_is_high_speed(conf);
+        change_dev = fa_conf_change_device(vtss_state, port_no, conf);
+        if (change_dev) {
+            high_speed_dev = !high_speed_dev;
+        } else if (conf->power_down) {
+            continue; /* No flush */
+        }
+        prep[i] = (high_speed_dev ? FA_FLUSH_PREP_HIGH : FA_FLUSH_PREP_2G5);
+
+        /* The new device of a disabled Serdes is flushed after the Serdes is enabled (to get clock) */
+        flush_late[i] = (!change_dev && sd_disabled);
+        flush_early[i] = !flush_late[i];
+    }
+
+    fa_port_conf_list_flush(vtss_state, cnt, port_list, prep, flush_early);
+    fa_port_conf_list_serdes(vtss_state, cnt, port_list, sd_mode);
+    fa_port_conf_list_flush(vtss_state, cnt, port_list, prep, flush_late);
+    return VTSS_RC_OK;
+}
+
+static vtss_rc fa_port_conf_apply(vtss_state_t *vtss_state, const vtss_port_no_t port_no)
 {
     vtss_port_conf_t      *conf = &vtss_state->port.conf[port_no];
     u32                   port = VTSS_CHIP_PORT(port_no), bt_indx;
@@ -2979,6 +3516,9 @@ static vtss_rc fa_port_conf_set(vtss_state_t *vtss_state, const vtss_port_no_t p
         return VTSS_RC_ERROR;
     }
 
+    /* Abandon a status wait in progress for the old configuration */
+    VTSS_RC(fa_port_wait_cancel(vtss_state, port_no));
+
     /* All high speed (>2G5) ports have a shadow 2G5 device. */
     /* Only one of them can be active and attached to the switch core at a time. */
     /* Every time the devices changes a port flush (shut down) must be performed on the DEV that is not active. */
@@ -3052,6 +3592,17 @@ static vtss_rc fa_port_conf_set(vtss_state_t *vtss_state, const vtss_port_no_t p
     return VTSS_RC_OK;
 }
 
+static vtss_rc fa_port_conf_set(vtss_state_t *vtss_state, const vtss_port_no_t port_no)
+{
+    vtss_rc rc = fa_port_conf_apply(vtss_state, port_no);
+
+    /* The flush steps and Serdes setup prepared by fa_port_conf_list_prepare() only apply to this call,
+       also if it failed before reaching them */
+    vtss_state->port.flush_prepared[port_no] = FA_FLUSH_PREP_NONE;
+    vtss_state->port.sd_prepared[port_no] = FALSE;
+    return rc;
+}
+
 
 
 /* Get status of the SFI and 100FX ports. */
@@ -3065,6 +3616,7 @@ static vtss_rc fa_port_status_get(vtss_state_t *vtss_state,
     u32              tgt = vtss_fa_dev_tgt(vtss_state, port_no);
     u32              sd_indx = 0, sd_type, sd_tgt;
     BOOL             analog_sd = FALSE, kr_aneg_ena = FALSE;
+    u8               wait;
 
     if (conf->power_down) {
         /* Disabled port is considered down */
@@ -3073,33 +3625,51 @@ static vtss_rc fa_port_status_get(vtss_state_t *vtss_state,
 
     switch (vtss_state->port.conf[port_no].if_type) {
     case VTSS_PORT_INTERFACE_100FX:
-        /* Get the PCS status  */
-        REG_RD(VTSS_DEV1G_PCS_FX100_STATUS(tgt), &value);
+        status->speed = VTSS_SPEED_100M;
+        sd_tgt = VTSS_TO_SD_LANE(vtss_fa_sd_lane_indx(vtss_state, port_no));
+        wait = vtss_state->port.wait_state[port_no];
+        if (wait != FA_PORT_WAIT_NONE) {
+            /* Serdes re-calibration in progress, the link is down until it completes */
+            if (fa_port_wait_pending(vtss_state, port_no, wait)) {
+                break;
+            }
+            if (wait == FA_PORT_WAIT_FX_RX_RST) {
+                /* Reset done after 3 msec */
+                REG_WRM(VTSS_SD_LANE_TARGET_SD_LANE_CFG(sd_tgt),
+                        VTSS_F_SD_LANE_TARGET_SD_LANE_CFG_LANE_RX_RST(0),
+                        VTSS_M_SD_LANE_TARGET_SD_LANE_CFG_LANE_RX_RST);
+                fa_port_wait_start(vtss_state, port_no, FA_PORT_WAIT_FX_RX_RUN, 1);
+                break;
+            }
+            if (wait == FA_PORT_WAIT_FX_RX_RUN) {
+                /* Clear the stickies and re-read after 1 msec */
+                REG_RD(VTSS_DEV1G_PCS_FX100_STATUS(tgt), &value);
+                REG_WR(VTSS_DEV1G_PCS_FX100_STATUS(tgt), value);
+                fa_port_wait_start(vtss_state, port_no, FA_PORT_WAIT_FX_CLEAR, 1);
+                break;
+            }
+            /* Re-calibration done, get the link state from the re-read */
+            vtss_state->port.wait_state[port_no] = FA_PORT_WAIT_NONE;
+            REG_RD(VTSS_DEV1G_PCS_FX100_STATUS(tgt), &value);
+        } else {
+            /* Get the PCS status  */
+            REG_RD(VTSS_DEV1G_PCS_FX100_STATUS(tgt), &value);
 
-        /* Link has been down if the are any error stickies */
-        status->link_down = VTSS_X_DEV1G_PCS_FX100_STATUS_SYNC_LOST_STICKY(value) ||
-                            VTSS_X_DEV1G_PCS_FX100_STATUS_FEF_FOUND_STICKY(value) ||
-                            VTSS_X_DEV1G_PCS_FX100_STATUS_PCS_ERROR_STICKY(value) ||
-                            VTSS_X_DEV1G_PCS_FX100_STATUS_SSD_ERROR_STICKY(value) ||
-                            VTSS_X_DEV1G_PCS_FX100_STATUS_FEF_STATUS(value);
+            /* Link has been down if the are any error stickies */
+            status->link_down = VTSS_X_DEV1G_PCS_FX100_STATUS_SYNC_LOST_STICKY(value) ||
+                                VTSS_X_DEV1G_PCS_FX100_STATUS_FEF_FOUND_STICKY(value) ||
+                                VTSS_X_DEV1G_PCS_FX100_STATUS_PCS_ERROR_STICKY(value) ||
+                                VTSS_X_DEV1G_PCS_FX100_STATUS_SSD_ERROR_STICKY(value) ||
+                                VTSS_X_DEV1G_PCS_FX100_STATUS_FEF_STATUS(value);
 
-        if (status->link_down) {
-            /* Reset the serdes for re-calibration */
-            u32 indx = vtss_fa_sd_lane_indx(vtss_state, port_no);
-            u32 sd_lane_tgt = VTSS_TO_SD_LANE(indx);
-            REG_WRM(VTSS_SD_LANE_TARGET_SD_LANE_CFG(sd_lane_tgt),
-                    VTSS_F_SD_LANE_TARGET_SD_LANE_CFG_LANE_RX_RST(1),
-                    VTSS_M_SD_LANE_TARGET_SD_LANE_CFG_LANE_RX_RST);
-            VTSS_MSLEEP(3);
-            REG_WRM(VTSS_SD_LANE_TARGET_SD_LANE_CFG(sd_lane_tgt),
-                    VTSS_F_SD_LANE_TARGET_SD_LANE_CFG_LANE_RX_RST(0),
-                    VTSS_M_SD_LANE_TARGET_SD_LANE_CFG_LANE_RX_RST);
-            VTSS_MSLEEP(1);
-
-            /* Clear the stickies and re-read */
-            REG_WR(VTSS_DEV1G_PCS_FX100_STATUS(tgt), value);
-            VTSS_MSLEEP(1);
-            REG_RD(VTSS_DEV1G_PCS_FX100_STATUS(tgt), &value);
+            if (status->link_down) {
+                /* Reset the serdes for re-calibration, continued by the next status polls */
+                REG_WRM(VTSS_SD_LANE_TARGET_SD_LANE_CFG(sd_tgt),
+                        VTSS_F_SD_LANE_TARGET_SD_LANE_CFG_LANE_RX_RST(1),
+                        VTSS_M_SD_LANE_TARGET_SD_LANE_CFG_LANE_RX_RST);
+                fa_port_wait_start(vtss_state, port_no, FA_PORT_WAIT_FX_RX_RST, 3);
+                break;
+            }
         }
         /* Link=1 if sync status=1 and no error stickies after a clear */
         status->link = VTSS_X_DEV1G_PCS_FX100_STATUS_SYNC_STATUS(value) &&
@@ -3108,8 +3678,6 @@ static vtss_rc fa_port_status_get(vtss_state_t *vtss_state,
             !VTSS_X_DEV1G_PCS_FX100_STATUS_PCS_ERROR_STICKY(value) &&
             !VTSS_X_DEV1G_PCS_FX100_STATUS_SSD_ERROR_STICKY(value) &&
             !VTSS_X_DEV1G_PCS_FX100_STATUS_FEF_STATUS(value);
-
-        status->speed = VTSS_SPEED_100M;
         break;
     case VTSS_PORT_INTERFACE_VAUI:
         /* Get the PCS status */
@@ -4360,11 +4928,15 @@ vtss_rc vtss_fa_port_init(vtss_state_t *vtss_state, vtss_init_cmd_t cmd)
     case VTSS_INIT_CMD_CREATE:
         state->miim_read = fa_miim_read;
         state->miim_write = fa_miim_write;
+        state->miim_access_list = fa_miim_access_list;
+        state->miim_scan_conf_set = fa_miim_scan_conf_set;
+        state->miim_scan_status_get = fa_miim_scan_status_get;
         state->mmd_read = fa_mmd_read;
         state->mmd_read_inc = fa_mmd_read_inc;
         state->mmd_write = fa_mmd_write;
         state->conf_get = fa_port_conf_get;
         state->conf_set = fa_port_conf_set;
+        state->conf_list_prepare = fa_port_conf_list_prepare;
         state->clause_37_status_get = fa_port_clause_37_status_get;
         state->clause_37_control_get = fa_port_clause_37_control_get;
         state->clause_37_control_set = fa_port_clause_37_control_set;
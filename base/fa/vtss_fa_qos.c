@@ -66,16 +66,51 @@ static u64 lb_group_lb_pup_token_calc(u64 ir_in_bps, u32 pup_interval)
     return VTSS_DIV64_ROUND_UP((ir_in_bps * (u64)pup_interval), (lb_clk_in_hz * 8));
 }
 
+/* LBs are ordered in a group so that the next LB is always with higher index.
+   The LB sets of each group are kept in a bit mask, so the neighbours are found a word at a time */
 static i32 lb_prev_lb_set_get(vtss_state_t *vtss_state, u32 grp_idx, u32 lb_set_idx)
 {
-    i32 i;
+    u32 *mask = vtss_state->qos.lb_set_mask[grp_idx];
+    i32 w = (lb_set_idx / 32), i;
+    u32 m = (mask[w] & (VTSS_BIT(lb_set_idx % 32) - 1));
 
-    for (i = (lb_set_idx - 1); (i >= 0); i--) {     /* LBs are ordered in a group so that the next LB is always with higher index */
-        if (vtss_state->qos.lb_set_grp_idx[i] == grp_idx) {
-            break;
+    while (m == 0) {
+        if (--w < 0) {
+            return -1;
         }
+        m = mask[w];
+    }
+    for (i = 31; (m & VTSS_BIT(i)) == 0; i--) {
+    }
+    return ((w * 32) + i);
+}
+
+static i32 lb_next_lb_set_get(vtss_state_t *vtss_state, u32 grp_idx, u32 lb_set_idx)
+{
+    u32 *mask = vtss_state->qos.lb_set_mask[grp_idx];
+    u32 start = (lb_set_idx + 1), w = (start / 32), i;
+    u32 m = (mask[w] & ~(VTSS_BIT(start % 32) - 1));
+
+    while (m == 0) {
+        if (++w >= LB_SET_WORDS) {
+            return -1;
+        }
+        m = mask[w];
+    }
+    for (i = 0; (m & VTSS_BIT(i)) == 0; i++) {
+    }
+    return ((w * 32) + i);
+}
+
+static void lb_set_mask_set(vtss_state_t *vtss_state, u32 grp_idx, u32 lb_set_idx, BOOL enable)
+{
+    u32 *mask = &vtss_state->qos.lb_set_mask[grp_idx][lb_set_idx / 32];
+
+    if (enable) {
+        *mask |= VTSS_BIT(lb_set_idx % 32);
+    } else {
+        *mask &= ~VTSS_BIT(lb_set_idx % 32);
     }
-    return i;
 }
 
 /* ir and max_ir in 1000 bit/s or f/s */
@@ -417,8 +452,8 @@ static vtss_rc lb_group_add(vtss_state_t *vtss_state, u64 max_rate, u32 min_burs
 static vtss_rc lb_group_lb_set_remove(vtss_state_t *vtss_state, u32 lb_set_idx)
 {
     vtss_qos_lb_group_t *group;
-    u32                 reg, nxt_idx, grp_idx;
-    i32                 prev_idx;
+    u32                 nxt_idx, grp_idx;
+    i32                 prev_idx, next_idx;
 
     VTSS_D("Enter  lb_set_idx %u", lb_set_idx);
 
@@ -445,9 +480,8 @@ static vtss_rc lb_group_lb_set_remove(vtss_state_t *vtss_state, u32 lb_set_idx)
             /* Find the previous LB in group - the one with lower index */
             prev_idx = lb_prev_lb_set_get(vtss_state, grp_idx, lb_set_idx);
 
-            REG_RD(VTSS_ANA_AC_SDLB_XLB_NEXT(lb_set_idx), &reg);
-            nxt_idx = VTSS_X_ANA_AC_SDLB_XLB_NEXT_LBSET_NEXT(reg);      /* Next LB is take from this LB set */
-            nxt_idx = (nxt_idx == lb_set_idx) ? prev_idx : nxt_idx;     /* If this LB is pointing to itself then it is last so previous LB is now last pointing to itself */
+            next_idx = lb_next_lb_set_get(vtss_state, grp_idx, lb_set_idx);
+            nxt_idx = (next_idx < 0) ? prev_idx : next_idx;             /* If this LB is last then previous LB is now last pointing to itself */
 
             VTSS_D("Remove LB %u  prev_idx %i  nxt_idx %u", lb_set_idx, prev_idx, nxt_idx);
             if (prev_idx < 0) { /* No previous LB was found */
@@ -466,6 +500,9 @@ static vtss_rc lb_group_lb_set_remove(vtss_state_t *vtss_state, u32 lb_set_idx)
     REG_WR(VTSS_ANA_AC_SDLB_PUP_TOKENS(lb_set_idx, 0), VTSS_F_ANA_AC_SDLB_PUP_TOKENS_PUP_TOKENS(0x1fff));
     REG_WR(VTSS_ANA_AC_SDLB_PUP_TOKENS(lb_set_idx, 1), VTSS_F_ANA_AC_SDLB_PUP_TOKENS_PUP_TOKENS(0x1fff));
     REG_WRM(VTSS_ANA_AC_SDLB_XLB_NEXT(lb_set_idx), VTSS_F_ANA_AC_SDLB_XLB_NEXT_LBSET_NEXT(lb_set_idx), VTSS_M_ANA_AC_SDLB_XLB_NEXT_LBSET_NEXT); /* Point to self */
+    if (grp_idx < LB_GROUP_CNT) {
+        lb_set_mask_set(vtss_state, grp_idx, lb_set_idx, FALSE);
+    }
     vtss_state->qos.lb_set_grp_idx[lb_set_idx] = LB_GROUP_CNT;     /* This LB set is no longer in a group */
 
     VTSS_D("Exit");
@@ -475,8 +512,8 @@ static vtss_rc lb_group_lb_set_remove(vtss_state_t *vtss_state, u32 lb_set_idx)
 
 static vtss_rc lb_group_lb_set_add(vtss_state_t *vtss_state, u32 grp_idx, u32 lb_set_idx, vtss_dlb_policer_conf_t *conf)
 {
-    u32                  reg, sum, nxt_idx, i, mark_all_red = 0, drop_yellow = 0;
-    i32                  prev_idx;
+    u32                  sum, nxt_idx, i, mark_all_red = 0, drop_yellow = 0;
+    i32                  prev_idx, next_idx;
     vtss_qos_lb_group_t  *group, *grp;
 
     VTSS_D("Enter  grp_idx %u  lb_set_idx %u", grp_idx, lb_set_idx);
@@ -559,16 +596,13 @@ static vtss_rc lb_group_lb_set_add(vtss_state_t *vtss_state, u32 grp_idx, u32 lb
     } else {
         /* Find the previous LB in group - the one with lower index */
         prev_idx = lb_prev_lb_set_get(vtss_state, grp_idx, lb_set_idx);
+        next_idx = lb_next_lb_set_get(vtss_state, grp_idx, lb_set_idx);
+        nxt_idx = (next_idx < 0) ? lb_set_idx : next_idx;               /* If no LB has higher index then this LB is now last pointing to itself */
         if (prev_idx < 0) { /* No previous LB was found */
-            REG_RD(VTSS_ANA_AC_SDLB_XLB_START(grp_idx), &reg)
-            nxt_idx = VTSS_X_ANA_AC_SDLB_XLB_START_LBSET_START(reg);    /* Next LB is take from the group */
             REG_WR(VTSS_ANA_AC_SDLB_XLB_NEXT(lb_set_idx),
                 (VTSS_F_ANA_AC_SDLB_XLB_NEXT_LBSET_NEXT(nxt_idx) | VTSS_F_ANA_AC_SDLB_XLB_NEXT_LBGRP(grp_idx))); /* This LB is pointing to next LB */
             REG_WR(VTSS_ANA_AC_SDLB_XLB_START(grp_idx), VTSS_F_ANA_AC_SDLB_XLB_START_LBSET_START(lb_set_idx))    /* Group is pointing to this LB */
         } else { /* Previous LB was found */
-            REG_RD(VTSS_ANA_AC_SDLB_XLB_NEXT(prev_idx), &reg)
-            nxt_idx = VTSS_X_ANA_AC_SDLB_XLB_NEXT_LBSET_NEXT(reg);      /* Next LB is take from previous LB */
-            nxt_idx = (nxt_idx == prev_idx) ? lb_set_idx : nxt_idx;     /* If previous LB is pointing to itself then it is last so this LB is now last pointing to itself */
             REG_WR(VTSS_ANA_AC_SDLB_XLB_NEXT(lb_set_idx),
                 (VTSS_F_ANA_AC_SDLB_XLB_NEXT_LBSET_NEXT(nxt_idx) | VTSS_F_ANA_AC_SDLB_XLB_NEXT_LBGRP(grp_idx))); /* This LB is pointing to next LB */
             REG_WRM(VTSS_ANA_AC_SDLB_XLB_NEXT(prev_idx),
@@ -580,6 +614,7 @@ static vtss_rc lb_group_lb_set_add(vtss_state_t *vtss_state, u32 grp_idx, u32 lb
     }
 
     vtss_state->qos.lb_set_grp_idx[lb_set_idx] = grp_idx;   /* This LB set is now in a group */
+    lb_set_mask_set(vtss_state, grp_idx, lb_set_idx, TRUE);
 
     VTSS_D("Exit");
 
@@ -612,6 +647,7 @@ static vtss_rc fa_qos_lb_init(vtss_state_t *vtss_state)
     for (i = 0; i < LB_SET_CNT; ++i) {
         vtss_state->qos.lb_set_grp_idx[i] = LB_GROUP_CNT;
     }
+    VTSS_MEMSET(vtss_state->qos.lb_set_mask, 0, sizeof(vtss_state->qos.lb_set_mask));
 
     VTSS_D("Exit");
 
@@ -1096,23 +1132,17 @@ static vtss_rc fa_qos_leak_time(vtss_state_t *vtss_state,
     return VTSS_RC_OK;
 }
 
-static vtss_rc fa_qos_leak_list_unlink(vtss_state_t *vtss_state,
-                                       const u32    layer,
-                                       const u32    se)
+/* Remove entry from its leak chain. The leak period must have been waited for by the caller */
+static vtss_rc fa_qos_leak_entry_unlink(vtss_state_t *vtss_state,
+                                        const u32    layer,
+                                        const u32    se)
 {
     vtss_qos_leak_layer_t *ll = &vtss_state->qos.leak_conf.layer[layer];
     vtss_qos_leak_entry_t *le = &ll->entry[se];
 
-    VTSS_D("Enter - layer %u, se %u", layer, se);
-
-    if (layer >= VTSS_HSCH_LAYERS) {
-        VTSS_E("Invalid layer %u!", layer);
-        return VTSS_RC_ERROR;
-    }
-
-    if (se >= vtss_state->qos.leak_conf.layer[layer].entries) {
-        VTSS_E("se %u >= %u in layer %u!", se, vtss_state->qos.leak_conf.layer[layer].entries, layer);
-        return VTSS_RC_ERROR;
+    if (le->unlink) {
+        le->unlink = FALSE;
+        ll->unlinks--;
     }
 
     if (le->enabled) {
@@ -1120,15 +1150,6 @@ static vtss_rc fa_qos_leak_list_unlink(vtss_state_t *vtss_state,
         BOOL                  first = (se == le->prev);
         BOOL                  last  = (se == le->next);
 
-        /*
-         * Shaper(s) MUST be disabled before calling this function!
-         * The leak algorithm needs to run at least once in order to stop the shaper.
-         * If the shaper is active (is shaping) and the leaking is disabled before the
-         * leak algorithm has been run, all traffic is blocked by the shaper.
-         */
-
-        VTSS_NSLEEP(lg->leak_time);     /* Sleep one leak period */
-
         if (first) {
             if (last) {
                 /* This is the one and only entry in the list. Disable leaking by setting leak_time to zero */
@@ -1173,6 +1194,111 @@ static vtss_rc fa_qos_leak_list_unlink(vtss_state_t *vtss_state,
         lg->cur_ses--;
     }
 
+    return VTSS_RC_OK;
+}
+
+static vtss_rc fa_qos_leak_list_check(vtss_state_t *vtss_state,
+                                      const u32    layer,
+                                      const u32    se)
+{
+    if (layer >= VTSS_HSCH_LAYERS) {
+        VTSS_E("Invalid layer %u!", layer);
+        return VTSS_RC_ERROR;
+    }
+
+    if (se >= vtss_state->qos.leak_conf.layer[layer].entries) {
+        VTSS_E("se %u >= %u in layer %u!", se, vtss_state->qos.leak_conf.layer[layer].entries, layer);
+        return VTSS_RC_ERROR;
+    }
+    return VTSS_RC_OK;
+}
+
+static vtss_rc fa_qos_leak_list_unlink(vtss_state_t *vtss_state,
+                                       const u32    layer,
+                                       const u32    se)
+{
+    vtss_qos_leak_layer_t *ll = &vtss_state->qos.leak_conf.layer[layer];
+    vtss_qos_leak_entry_t *le = &ll->entry[se];
+
+    VTSS_D("Enter - layer %u, se %u", layer, se);
+
+    VTSS_RC(fa_qos_leak_list_check(vtss_state, layer, se));
+
+    if (le->enabled) {
+        /*
+         * Shaper(s) MUST be disabled before calling this function!
+         * The leak algorithm needs to run at least once in order to stop the shaper.
+         * If the shaper is active (is shaping) and the leaking is disabled before the
+         * leak algorithm has been run, all traffic is blocked by the shaper.
+         */
+
+        VTSS_NSLEEP(ll->group[le->group].leak_time);     /* Sleep one leak period */
+
+        VTSS_RC(fa_qos_leak_entry_unlink(vtss_state, layer, se));
+    }
+
+    VTSS_D("Exit");
+    return VTSS_RC_OK;
+}
+
+/* Unlink a disabled shaper. Inside a batch, the unlink is deferred until the batch ends */
+static vtss_rc fa_qos_leak_list_release(vtss_state_t *vtss_state,
+                                        const u32    layer,
+                                        const u32    se)
+{
+    vtss_qos_leak_conf_t  *lc = &vtss_state->qos.leak_conf;
+    vtss_qos_leak_layer_t *ll = &lc->layer[layer];
+    vtss_qos_leak_entry_t *le = &ll->entry[se];
+
+    if (lc->batch == 0) {
+        return fa_qos_leak_list_unlink(vtss_state, layer, se);
+    }
+
+    VTSS_RC(fa_qos_leak_list_check(vtss_state, layer, se));
+
+    if (le->enabled && !le->unlink) {
+        VTSS_D("Defer - layer %u, se %u", layer, se);
+        le->unlink = TRUE;
+        ll->unlinks++;
+        lc->batch_wait = MAX(lc->batch_wait, ll->group[le->group].leak_time);
+    }
+    return VTSS_RC_OK;
+}
+
+/* Start a batch of shaper changes. Leak list unlinks are deferred until the batch ends */
+static void fa_qos_leak_batch_begin(vtss_state_t *vtss_state)
+{
+    vtss_state->qos.leak_conf.batch++;
+}
+
+/* End a batch of shaper changes. One leak period is waited before all deferred unlinks are done */
+static vtss_rc fa_qos_leak_batch_end(vtss_state_t *vtss_state)
+{
+    vtss_qos_leak_conf_t  *lc = &vtss_state->qos.leak_conf;
+    vtss_qos_leak_layer_t *ll;
+    u32                   layer, se;
+
+    if (lc->batch == 0 || --lc->batch != 0) {
+        return VTSS_RC_OK;
+    }
+
+    if (lc->batch_wait == 0) {
+        return VTSS_RC_OK;
+    }
+
+    VTSS_D("Enter - wait %u", lc->batch_wait);
+    VTSS_NSLEEP(lc->batch_wait);     /* Sleep one leak period of the slowest group involved */
+    lc->batch_wait = 0;
+
+    for (layer = 0; layer < VTSS_HSCH_LAYERS; layer++) {
+        ll = &lc->layer[layer];
+        for (se = 0; ll->unlinks != 0 && se < ll->entries; se++) {
+            if (ll->entry[se].unlink) {
+                VTSS_RC(fa_qos_leak_entry_unlink(vtss_state, layer, se));
+            }
+        }
+    }
+
     VTSS_D("Exit");
     return VTSS_RC_OK;
 }
@@ -1192,14 +1318,12 @@ static vtss_rc fa_qos_leak_list_link(vtss_state_t         *vtss_state,
 
     VTSS_D("Enter - layer %u, se %u, rate %u", layer, se, rate);
 
-    if (layer >= VTSS_HSCH_LAYERS) {
-        VTSS_E("Invalid layer %u!", layer);
-        return VTSS_RC_ERROR;
-    }
+    VTSS_RC(fa_qos_leak_list_check(vtss_state, layer, se));
 
-    if (se >= vtss_state->qos.leak_conf.layer[layer].entries) {
-        VTSS_E("se %u >= %u in layer %u!", se, vtss_state->qos.leak_conf.layer[layer].entries, layer);
-        return VTSS_RC_ERROR;
+    if (le->unlink) {
+        /* Entry is enabled again in the same batch, so it is kept in its leak chain */
+        le->unlink = FALSE;
+        ll->unlinks--;
     }
 
     if (le->enabled) {
@@ -1364,7 +1488,7 @@ vtss_rc vtss_fa_qos_shaper_conf_set(vtss_state_t *vtss_state, vtss_shaper_t *sha
                 VTSS_F_HSCH_SE_CFG_SE_FRM_MODE(0), /* Set to default */
                 VTSS_M_HSCH_SE_CFG_SE_FRM_MODE);
 
-        VTSS_RC(fa_qos_leak_list_unlink(vtss_state, layer, se));
+        VTSS_RC(fa_qos_leak_list_release(vtss_state, layer, se));
     }
 
     VTSS_D("Exit");
@@ -1452,9 +1576,15 @@ static vtss_rc fa_qos_port_conf_set(vtss_state_t *vtss_state, const vtss_port_no
     vtss_qos_port_conf_t *old_conf = &vtss_state->qos.port_conf_old;
     u32                  chip_port = VTSS_CHIP_PORT(port_no);
     u32                  pcp, dei, tag_pcp_cfg, tag_dei_cfg, class, policer, queue;
+    BOOL                 all = !vtss_state->qos.port_conf_applied[port_no];
+    vtss_rc              rc;
 
     VTSS_D("Enter - port_no: %u", port_no);
 
+    // Only registers that differ from the previous configuration are written,
+    // unless this is the first apply since initialization or restart.
+    vtss_state->qos.port_conf_applied[port_no] = FALSE;
+
     // Port specific configuration for:
     // * Default PCP classification (ingress)
     // * Default DEI classification (ingress)
@@ -1462,37 +1592,53 @@ static vtss_rc fa_qos_port_conf_set(vtss_state_t *vtss_state, const vtss_port_no
     // * Basic DP classification (ingress)
     // * Basic DSCP classification (ingress)
     // * Basic CoSID classification (ingress)
-    REG_WRM(VTSS_ANA_CL_VLAN_CTRL(chip_port),
-            VTSS_F_ANA_CL_VLAN_CTRL_PORT_PCP(conf->usr_prio)     |
-            VTSS_F_ANA_CL_VLAN_CTRL_PORT_DEI(conf->default_dei),
-            VTSS_M_ANA_CL_VLAN_CTRL_PORT_PCP                     |
-            VTSS_M_ANA_CL_VLAN_CTRL_PORT_DEI);
-    REG_WRM(VTSS_ANA_CL_QOS_CFG(chip_port),
-            VTSS_F_ANA_CL_QOS_CFG_DEFAULT_QOS_VAL(vtss_cmn_qos_chip_prio(vtss_state, conf->default_prio)) |
-            VTSS_F_ANA_CL_QOS_CFG_PCP_DEI_QOS_ENA(conf->tag_class_enable)                                 |
-            VTSS_F_ANA_CL_QOS_CFG_DSCP_TRANSLATE_ENA(conf->dscp_translate)                                |
-            VTSS_F_ANA_CL_QOS_CFG_DSCP_QOS_ENA(conf->dscp_class_enable)                                   |
-            VTSS_F_ANA_CL_QOS_CFG_DEFAULT_DP_VAL(conf->default_dpl)                                       |
-            VTSS_F_ANA_CL_QOS_CFG_PCP_DEI_DP_ENA(conf->tag_class_enable)                                  |
-            VTSS_F_ANA_CL_QOS_CFG_DSCP_DP_ENA(conf->dscp_class_enable)                                    |
-            VTSS_F_ANA_CL_QOS_CFG_DSCP_REWR_MODE_SEL(conf->dscp_mode)                                     |
-            VTSS_F_ANA_CL_QOS_CFG_DEFAULT_COSID_ENA(1)                                                    |
-            VTSS_F_ANA_CL_QOS_CFG_DEFAULT_COSID_VAL(conf->cosid),
-            VTSS_M_ANA_CL_QOS_CFG_DEFAULT_QOS_VAL                                                         |
-            VTSS_M_ANA_CL_QOS_CFG_PCP_DEI_QOS_ENA                                                         |
-            VTSS_M_ANA_CL_QOS_CFG_DSCP_TRANSLATE_ENA                                                      |
-            VTSS_M_ANA_CL_QOS_CFG_DSCP_QOS_ENA                                                            |
-            VTSS_M_ANA_CL_QOS_CFG_DEFAULT_DP_VAL                                                          |
-            VTSS_M_ANA_CL_QOS_CFG_PCP_DEI_DP_ENA                                                          |
-            VTSS_M_ANA_CL_QOS_CFG_DSCP_DP_ENA                                                             |
-            VTSS_M_ANA_CL_QOS_CFG_DSCP_REWR_MODE_SEL                                                      |
-            VTSS_M_ANA_CL_QOS_CFG_DEFAULT_COSID_ENA                                                       |
-            VTSS_M_ANA_CL_QOS_CFG_DEFAULT_COSID_VAL);
+    if (all || conf->usr_prio != old_conf->usr_prio || conf->default_dei != old_conf->default_dei) {
+        REG_WRM(VTSS_ANA_CL_VLAN_CTRL(chip_port),
+                VTSS_F_ANA_CL_VLAN_CTRL_PORT_PCP(conf->usr_prio)     |
+                VTSS_F_ANA_CL_VLAN_CTRL_PORT_DEI(conf->default_dei),
+                VTSS_M_ANA_CL_VLAN_CTRL_PORT_PCP                     |
+                VTSS_M_ANA_CL_VLAN_CTRL_PORT_DEI);
+    }
+    if (all ||
+        conf->default_prio != old_conf->default_prio ||
+        conf->tag_class_enable != old_conf->tag_class_enable ||
+        conf->dscp_translate != old_conf->dscp_translate ||
+        conf->dscp_class_enable != old_conf->dscp_class_enable ||
+        conf->default_dpl != old_conf->default_dpl ||
+        conf->dscp_mode != old_conf->dscp_mode ||
+        conf->cosid != old_conf->cosid) {
+        REG_WRM(VTSS_ANA_CL_QOS_CFG(chip_port),
+                VTSS_F_ANA_CL_QOS_CFG_DEFAULT_QOS_VAL(vtss_cmn_qos_chip_prio(vtss_state, conf->default_prio)) |
+                VTSS_F_ANA_CL_QOS_CFG_PCP_DEI_QOS_ENA(conf->tag_class_enable)                                 |
+                VTSS_F_ANA_CL_QOS_CFG_DSCP_TRANSLATE_ENA(conf->dscp_translate)                                |
+                VTSS_F_ANA_CL_QOS_CFG_DSCP_QOS_ENA(conf->dscp_class_enable)                                   |
+                VTSS_F_ANA_CL_QOS_CFG_DEFAULT_DP_VAL(conf->default_dpl)                                       |
+                VTSS_F_ANA_CL_QOS_CFG_PCP_DEI_DP_ENA(conf->tag_class_enable)                                  |
+                VTSS_F_ANA_CL_QOS_CFG_DSCP_DP_ENA(conf->dscp_class_enable)                                    |
+                VTSS_F_ANA_CL_QOS_CFG_DSCP_REWR_MODE_SEL(conf->dscp_mode)                                     |
+                VTSS_F_ANA_CL_QOS_CFG_DEFAULT_COSID_ENA(1)                                                    |
+                VTSS_F_ANA_CL_QOS_CFG_DEFAULT_COSID_VAL(conf->cosid),
+                VTSS_M_ANA_CL_QOS_CFG_DEFAULT_QOS_VAL                                                         |
+                VTSS_M_ANA_CL_QOS_CFG_PCP_DEI_QOS_ENA                                                         |
+                VTSS_M_ANA_CL_QOS_CFG_DSCP_TRANSLATE_ENA                                                      |
+                VTSS_M_ANA_CL_QOS_CFG_DSCP_QOS_ENA                                                            |
+                VTSS_M_ANA_CL_QOS_CFG_DEFAULT_DP_VAL                                                          |
+                VTSS_M_ANA_CL_QOS_CFG_PCP_DEI_DP_ENA                                                          |
+                VTSS_M_ANA_CL_QOS_CFG_DSCP_DP_ENA                                                             |
+                VTSS_M_ANA_CL_QOS_CFG_DSCP_REWR_MODE_SEL                                                      |
+                VTSS_M_ANA_CL_QOS_CFG_DEFAULT_COSID_ENA                                                       |
+                VTSS_M_ANA_CL_QOS_CFG_DEFAULT_COSID_VAL);
+    }
 
     // Basic QoS and DP classification (ingress):
     // Map from (PCP, DEI) to QoS class and DP level.
     for (pcp = VTSS_PCP_START; pcp < VTSS_PCP_END; pcp++) {
         for (dei = VTSS_DEI_START; dei < VTSS_DEI_END; dei++) {
+            if (!all &&
+                conf->dp_level_map[pcp][dei] == old_conf->dp_level_map[pcp][dei] &&
+                conf->qos_class_map[pcp][dei] == old_conf->qos_class_map[pcp][dei]) {
+                continue;
+            }
             REG_WR(VTSS_ANA_CL_PCP_DEI_MAP_CFG(chip_port, (8 * dei + pcp)),
                    VTSS_F_ANA_CL_PCP_DEI_MAP_CFG_PCP_DEI_DP_VAL(conf->dp_level_map[pcp][dei]) |
                    VTSS_F_ANA_CL_PCP_DEI_MAP_CFG_PCP_DEI_QOS_VAL(vtss_cmn_qos_chip_prio(vtss_state, conf->qos_class_map[pcp][dei])));
@@ -1504,6 +1650,11 @@ static vtss_rc fa_qos_port_conf_set(vtss_state_t *vtss_state, const vtss_port_no
 
     // Port policing configuration.
     for (policer = 0; policer < VTSS_PORT_POLICERS; policer++) {
+        if (!all &&
+            !VTSS_MEMCMP(&conf->policer_port[policer], &old_conf->policer_port[policer], sizeof(conf->policer_port[policer])) &&
+            !VTSS_MEMCMP(&conf->policer_ext_port[policer], &old_conf->policer_ext_port[policer], sizeof(conf->policer_ext_port[policer]))) {
+            continue;
+        }
         VTSS_RC(fa_port_policer_set(vtss_state, chip_port, policer, &conf->policer_port[policer], &conf->policer_ext_port[policer]));
     }
 
@@ -1521,10 +1672,14 @@ static vtss_rc fa_qos_port_conf_set(vtss_state_t *vtss_state, const vtss_port_no
     VTSS_RC(fa_qos_dwrr_conf_set(vtss_state, port_no));
 
     // Port shaper configuration. Use scheduler element in layer 2 indexed by chip_port.
-    VTSS_RC(vtss_fa_qos_shaper_conf_set(vtss_state, &conf->shaper_port, 2, chip_port, chip_port, 0));
-
     // Queue shaper configuration.
-    VTSS_RC(fa_qos_queue_shaper_conf_set(vtss_state, port_no));
+    // Shapers are changed in one batch, so only one leak period is waited for removals.
+    fa_qos_leak_batch_begin(vtss_state);
+    if ((rc = vtss_fa_qos_shaper_conf_set(vtss_state, &conf->shaper_port, 2, chip_port, chip_port, 0)) == VTSS_RC_OK) {
+        rc = fa_qos_queue_shaper_conf_set(vtss_state, port_no);
+    }
+    VTSS_RC(fa_qos_leak_batch_end(vtss_state));
+    VTSS_RC(rc);
 
     // Cut-through configuration.
     VTSS_RC(fa_qos_queue_cut_through_set(vtss_state, port_no));
@@ -1535,16 +1690,20 @@ static vtss_rc fa_qos_port_conf_set(vtss_state_t *vtss_state, const vtss_port_no
         VTSS_E("Invalid WRED group: %u!", conf->wred_group);
         return VTSS_RC_ERROR;
     }
-    REG_WR(VTSS_QRES_WRED_GROUP(chip_port),
-           VTSS_F_QRES_WRED_GROUP_WRED_GROUP(conf->wred_group));
+    if (all || conf->wred_group != old_conf->wred_group) {
+        REG_WR(VTSS_QRES_WRED_GROUP(chip_port),
+               VTSS_F_QRES_WRED_GROUP_WRED_GROUP(conf->wred_group));
+    }
 #endif
     // Tag remarking configuration (egress)
     // Port default PCP and DEI values (egress)
-    REG_WRM(VTSS_REW_PORT_VLAN_CFG(chip_port),
-            VTSS_F_REW_PORT_VLAN_CFG_PORT_PCP(conf->tag_default_pcp) |
-            VTSS_F_REW_PORT_VLAN_CFG_PORT_DEI(conf->tag_default_dei),
-            VTSS_M_REW_PORT_VLAN_CFG_PORT_PCP                        |
-            VTSS_M_REW_PORT_VLAN_CFG_PORT_DEI);
+    if (all || conf->tag_default_pcp != old_conf->tag_default_pcp || conf->tag_default_dei != old_conf->tag_default_dei) {
+        REG_WRM(VTSS_REW_PORT_VLAN_CFG(chip_port),
+                VTSS_F_REW_PORT_VLAN_CFG_PORT_PCP(conf->tag_default_pcp) |
+                VTSS_F_REW_PORT_VLAN_CFG_PORT_DEI(conf->tag_default_dei),
+                VTSS_M_REW_PORT_VLAN_CFG_PORT_PCP                        |
+                VTSS_M_REW_PORT_VLAN_CFG_PORT_DEI);
+    }
     // Configure mode of PCP/DEI selection for the tag.
     // Currently we only support 3 modes:
     // * Classified PCP/DEI
@@ -1564,33 +1723,46 @@ static vtss_rc fa_qos_port_conf_set(vtss_state_t *vtss_state, const vtss_port_no
         tag_dei_cfg = 0; /* Classified DEI */
         break;
     }
-    REG_WRM(VTSS_REW_TAG_CTRL(chip_port),
-            VTSS_F_REW_TAG_CTRL_TAG_PCP_CFG(tag_pcp_cfg) |
-            VTSS_F_REW_TAG_CTRL_TAG_DEI_CFG(tag_dei_cfg),
-            VTSS_M_REW_TAG_CTRL_TAG_PCP_CFG              |
-            VTSS_M_REW_TAG_CTRL_TAG_DEI_CFG);
+    if (all || conf->tag_remark_mode != old_conf->tag_remark_mode) {
+        REG_WRM(VTSS_REW_TAG_CTRL(chip_port),
+                VTSS_F_REW_TAG_CTRL_TAG_PCP_CFG(tag_pcp_cfg) |
+                VTSS_F_REW_TAG_CTRL_TAG_DEI_CFG(tag_dei_cfg),
+                VTSS_M_REW_TAG_CTRL_TAG_PCP_CFG              |
+                VTSS_M_REW_TAG_CTRL_TAG_DEI_CFG);
+    }
     // Mapping tables for [classified QoS, DE (colour)] to PCP and DEI
     for (class = VTSS_QUEUE_START; class < VTSS_QUEUE_END; class++) {
-        REG_WR(VTSS_REW_PCP_MAP_DE0(chip_port, class),
-               VTSS_F_REW_PCP_MAP_DE0_PCP_DE0(conf->tag_pcp_map[class][0]));
-        REG_WR(VTSS_REW_PCP_MAP_DE1(chip_port, class),
-               VTSS_F_REW_PCP_MAP_DE1_PCP_DE1(conf->tag_pcp_map[class][1]));
-        REG_WR(VTSS_REW_DEI_MAP_DE0(chip_port, class),
-               VTSS_F_REW_DEI_MAP_DE0_DEI_DE0(conf->tag_dei_map[class][0]));
-        REG_WR(VTSS_REW_DEI_MAP_DE1(chip_port, class),
-               VTSS_F_REW_DEI_MAP_DE1_DEI_DE1(conf->tag_dei_map[class][1]));
+        if (all || conf->tag_pcp_map[class][0] != old_conf->tag_pcp_map[class][0]) {
+            REG_WR(VTSS_REW_PCP_MAP_DE0(chip_port, class),
+                   VTSS_F_REW_PCP_MAP_DE0_PCP_DE0(conf->tag_pcp_map[class][0]));
+        }
+        if (all || conf->tag_pcp_map[class][1] != old_conf->tag_pcp_map[class][1]) {
+            REG_WR(VTSS_REW_PCP_MAP_DE1(chip_port, class),
+                   VTSS_F_REW_PCP_MAP_DE1_PCP_DE1(conf->tag_pcp_map[class][1]));
+        }
+        if (all || conf->tag_dei_map[class][0] != old_conf->tag_dei_map[class][0]) {
+            REG_WR(VTSS_REW_DEI_MAP_DE0(chip_port, class),
+                   VTSS_F_REW_DEI_MAP_DE0_DEI_DE0(conf->tag_dei_map[class][0]));
+        }
+        if (all || conf->tag_dei_map[class][1] != old_conf->tag_dei_map[class][1]) {
+            REG_WR(VTSS_REW_DEI_MAP_DE1(chip_port, class),
+                   VTSS_F_REW_DEI_MAP_DE1_DEI_DE1(conf->tag_dei_map[class][1]));
+        }
     }
 
     // Egress DSCP remarking (legacy) configuration.
-    REG_WRM(VTSS_REW_DSCP_MAP(chip_port),
-            VTSS_F_REW_DSCP_MAP_DSCP_UPDATE_ENA((conf->dscp_emode > VTSS_DSCP_EMODE_DISABLE)) |
-            VTSS_F_REW_DSCP_MAP_DSCP_REMAP_ENA((conf->dscp_emode > VTSS_DSCP_EMODE_REMARK)),
-            VTSS_M_REW_DSCP_MAP_DSCP_UPDATE_ENA                                               |
-            VTSS_M_REW_DSCP_MAP_DSCP_REMAP_ENA);
+    if (all || conf->dscp_emode != old_conf->dscp_emode) {
+        REG_WRM(VTSS_REW_DSCP_MAP(chip_port),
+                VTSS_F_REW_DSCP_MAP_DSCP_UPDATE_ENA((conf->dscp_emode > VTSS_DSCP_EMODE_DISABLE)) |
+                VTSS_F_REW_DSCP_MAP_DSCP_REMAP_ENA((conf->dscp_emode > VTSS_DSCP_EMODE_REMARK)),
+                VTSS_M_REW_DSCP_MAP_DSCP_UPDATE_ENA                                               |
+                VTSS_M_REW_DSCP_MAP_DSCP_REMAP_ENA);
+    }
 
     // Update ES0-based default port QoS egress mapping
     VTSS_RC(vtss_fa_vcap_port_update(vtss_state, port_no));
 
+    vtss_state->qos.port_conf_applied[port_no] = TRUE;
     VTSS_D("Exit");
     return VTSS_RC_OK;
 }
@@ -1650,12 +1822,16 @@ static vtss_rc fa_storm_policer_set(vtss_state_t             *vtss_state,
     return VTSS_RC_OK;
 }
 
-static vtss_rc fa_qos_wred_conf_set(vtss_state_t *vtss_state)
+static vtss_rc fa_qos_wred_conf_set(vtss_state_t *vtss_state, BOOL all)
 {
 #ifdef VTSS_FEATURE_QOS_WRED_V3
     vtss_qos_conf_t *conf = &vtss_state->qos.conf;
     u32              group, queue, dpl, wm_high;
 
+    if (!all && !VTSS_MEMCMP(conf->red_v3, vtss_state->qos.conf_old.red_v3, sizeof(conf->red_v3))) {
+        return VTSS_RC_OK; // Unchanged
+    }
+
     VTSS_D("Enter");
     for (group = 0; group < VTSS_WRED_GROUP_CNT; group++) {
         for (queue = VTSS_QUEUE_START; queue < VTSS_QUEUE_END; queue++) {
@@ -1720,44 +1896,74 @@ static vtss_rc fa_qos_wred_conf_set(vtss_state_t *vtss_state)
 static vtss_rc fa_qos_conf_set(vtss_state_t *vtss_state, BOOL changed)
 {
     vtss_qos_conf_t *conf = &vtss_state->qos.conf;
+    vtss_qos_conf_t *old = &vtss_state->qos.conf_old;
+    vtss_port_no_t  port_no;
+    BOOL            all;
     u32             i;
 
     VTSS_D("Enter");
 
+    // Only registers that differ from the previous configuration are written,
+    // unless this is the first apply or the number of priorities has changed.
+    all = (changed || !vtss_state->qos.conf_applied);
+    vtss_state->qos.conf_applied = FALSE;
+    if (changed) {
+        // The chip priority of port defaults and maps depend on the number of priorities
+        for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
+            vtss_state->qos.port_conf_applied[port_no] = FALSE;
+        }
+    }
+
     // Global configuration for:
     // * Basic QoS classification
     // * Basic DP classification
     // * Basic DSCP classification
     // * Egress DSCP remarking
     for (i = 0; i < 64; i++) {
-        REG_WRM(VTSS_ANA_CL_DSCP_CFG(i),
-                VTSS_F_ANA_CL_DSCP_CFG_DSCP_TRANSLATE_VAL(conf->dscp_translate_map[i])                               |
-                VTSS_F_ANA_CL_DSCP_CFG_DSCP_TRUST_ENA(conf->dscp_trust[i])                                           |
-                VTSS_F_ANA_CL_DSCP_CFG_DSCP_QOS_VAL(vtss_cmn_qos_chip_prio(vtss_state, conf->dscp_qos_class_map[i])) |
-                VTSS_F_ANA_CL_DSCP_CFG_DSCP_DP_VAL(conf->dscp_dp_level_map[i])                                       |
-                VTSS_F_ANA_CL_DSCP_CFG_DSCP_REWR_ENA(conf->dscp_remark[i]),
-                VTSS_M_ANA_CL_DSCP_CFG_DSCP_TRANSLATE_VAL                                                            |
-                VTSS_M_ANA_CL_DSCP_CFG_DSCP_TRUST_ENA                                                                |
-                VTSS_M_ANA_CL_DSCP_CFG_DSCP_QOS_VAL                                                                  |
-                VTSS_M_ANA_CL_DSCP_CFG_DSCP_DP_VAL                                                                   |
-                VTSS_M_ANA_CL_DSCP_CFG_DSCP_REWR_ENA);
-        REG_WRM(VTSS_REW_DSCP_REMAP(i),
-                VTSS_F_REW_DSCP_REMAP_DSCP_REMAP(conf->dscp_remap[i]),
-                VTSS_M_REW_DSCP_REMAP_DSCP_REMAP);
+        if (all ||
+            conf->dscp_translate_map[i] != old->dscp_translate_map[i] ||
+            conf->dscp_trust[i] != old->dscp_trust[i] ||
+            conf->dscp_qos_class_map[i] != old->dscp_qos_class_map[i] ||
+            conf->dscp_dp_level_map[i] != old->dscp_dp_level_map[i] ||
+            conf->dscp_remark[i] != old->dscp_remark[i]) {
+            REG_WRM(VTSS_ANA_CL_DSCP_CFG(i),
+                    VTSS_F_ANA_CL_DSCP_CFG_DSCP_TRANSLATE_VAL(conf->dscp_translate_map[i])                               |
+                    VTSS_F_ANA_CL_DSCP_CFG_DSCP_TRUST_ENA(conf->dscp_trust[i])                                           |
+                    VTSS_F_ANA_CL_DSCP_CFG_DSCP_QOS_VAL(vtss_cmn_qos_chip_prio(vtss_state, conf->dscp_qos_class_map[i])) |
+                    VTSS_F_ANA_CL_DSCP_CFG_DSCP_DP_VAL(conf->dscp_dp_level_map[i])                                       |
+                    VTSS_F_ANA_CL_DSCP_CFG_DSCP_REWR_ENA(conf->dscp_remark[i]),
+                    VTSS_M_ANA_CL_DSCP_CFG_DSCP_TRANSLATE_VAL                                                            |
+                    VTSS_M_ANA_CL_DSCP_CFG_DSCP_TRUST_ENA                                                                |
+                    VTSS_M_ANA_CL_DSCP_CFG_DSCP_QOS_VAL                                                                  |
+                    VTSS_M_ANA_CL_DSCP_CFG_DSCP_DP_VAL                                                                   |
+                    VTSS_M_ANA_CL_DSCP_CFG_DSCP_REWR_ENA);
+        }
+        if (all || conf->dscp_remap[i] != old->dscp_remap[i]) {
+            REG_WRM(VTSS_REW_DSCP_REMAP(i),
+                    VTSS_F_REW_DSCP_REMAP_DSCP_REMAP(conf->dscp_remap[i]),
+                    VTSS_M_REW_DSCP_REMAP_DSCP_REMAP);
+        }
     }
 
     // Basic DSCP classification:
     // Map from classified (QoS, DP) to DSCP.
     for (i = 0; i < 8; i++) {
-        REG_WR(VTSS_ANA_CL_QOS_MAP_CFG(i),
-               VTSS_F_ANA_CL_QOS_MAP_CFG_DSCP_REWR_VAL(conf->dscp_qos_map[i]));
-        REG_WR(VTSS_ANA_CL_QOS_MAP_CFG(i +  8),
-               VTSS_F_ANA_CL_QOS_MAP_CFG_DSCP_REWR_VAL(conf->dscp_qos_map_dp1[i]));
-        REG_WR(VTSS_ANA_CL_QOS_MAP_CFG(i + 16),
-               VTSS_F_ANA_CL_QOS_MAP_CFG_DSCP_REWR_VAL(conf->dscp_qos_map_dp2[i]));
-        REG_WR(VTSS_ANA_CL_QOS_MAP_CFG(i + 24),
-               VTSS_F_ANA_CL_QOS_MAP_CFG_DSCP_REWR_VAL(conf->dscp_qos_map_dp3[i]));
-
+        if (all || conf->dscp_qos_map[i] != old->dscp_qos_map[i]) {
+            REG_WR(VTSS_ANA_CL_QOS_MAP_CFG(i),
+                   VTSS_F_ANA_CL_QOS_MAP_CFG_DSCP_REWR_VAL(conf->dscp_qos_map[i]));
+        }
+        if (all || conf->dscp_qos_map_dp1[i] != old->dscp_qos_map_dp1[i]) {
+            REG_WR(VTSS_ANA_CL_QOS_MAP_CFG(i +  8),
+                   VTSS_F_ANA_CL_QOS_MAP_CFG_DSCP_REWR_VAL(conf->dscp_qos_map_dp1[i]));
+        }
+        if (all || conf->dscp_qos_map_dp2[i] != old->dscp_qos_map_dp2[i]) {
+            REG_WR(VTSS_ANA_CL_QOS_MAP_CFG(i + 16),
+                   VTSS_F_ANA_CL_QOS_MAP_CFG_DSCP_REWR_VAL(conf->dscp_qos_map_dp2[i]));
+        }
+        if (all || conf->dscp_qos_map_dp3[i] != old->dscp_qos_map_dp3[i]) {
+            REG_WR(VTSS_ANA_CL_QOS_MAP_CFG(i + 24),
+                   VTSS_F_ANA_CL_QOS_MAP_CFG_DSCP_REWR_VAL(conf->dscp_qos_map_dp3[i]));
+        }
     }
 
     // Storm policing configuration:
@@ -1767,13 +1973,23 @@ static vtss_rc fa_qos_conf_set(vtss_state_t *vtss_state, BOOL changed)
     // * Policer 1:   Multicast (unknown multicast frames).
     // * Policer 2:   Broadcast (known and unknown broadcast frames).
     // * Policer 3-7: Not used.
-    VTSS_RC(fa_storm_policer_set(vtss_state, 0, conf->policer_uc, conf->policer_uc_frame_rate, conf->policer_uc_mode));
-    VTSS_RC(fa_storm_policer_set(vtss_state, 1, conf->policer_mc, conf->policer_mc_frame_rate, conf->policer_mc_mode));
-    VTSS_RC(fa_storm_policer_set(vtss_state, 2, conf->policer_bc, conf->policer_bc_frame_rate, conf->policer_bc_mode));
+    if (all || conf->policer_uc != old->policer_uc ||
+        conf->policer_uc_frame_rate != old->policer_uc_frame_rate || conf->policer_uc_mode != old->policer_uc_mode) {
+        VTSS_RC(fa_storm_policer_set(vtss_state, 0, conf->policer_uc, conf->policer_uc_frame_rate, conf->policer_uc_mode));
+    }
+    if (all || conf->policer_mc != old->policer_mc ||
+        conf->policer_mc_frame_rate != old->policer_mc_frame_rate || conf->policer_mc_mode != old->policer_mc_mode) {
+        VTSS_RC(fa_storm_policer_set(vtss_state, 1, conf->policer_mc, conf->policer_mc_frame_rate, conf->policer_mc_mode));
+    }
+    if (all || conf->policer_bc != old->policer_bc ||
+        conf->policer_bc_frame_rate != old->policer_bc_frame_rate || conf->policer_bc_mode != old->policer_bc_mode) {
+        VTSS_RC(fa_storm_policer_set(vtss_state, 2, conf->policer_bc, conf->policer_bc_frame_rate, conf->policer_bc_mode));
+    }
 
     // WRED configuration:
-    VTSS_RC(fa_qos_wred_conf_set(vtss_state));
+    VTSS_RC(fa_qos_wred_conf_set(vtss_state, all));
 
+    vtss_state->qos.conf_applied = TRUE;
     VTSS_D("Exit");
     return VTSS_RC_OK;
 }
@@ -2149,29 +2365,33 @@ static vtss_rc fa_qos_cpu_port_shaper_set(vtss_state_t *vtss_state, const vtss_b
 {
     vtss_shaper_t  shaper;
     u32            port, queue, packet_rate, se;
+    vtss_rc        rc = VTSS_RC_OK;
 
     VTSS_D("Enter");
     VTSS_MEMSET(&shaper, 0, sizeof(shaper));
     shaper.rate  = rate;       // kbps
     shaper.level = (4096 * 4); // 16 kbytes burst size
-    for (port = VTSS_CHIP_PORT_CPU_0; port <= VTSS_CHIP_PORT_CPU_1; port++) {
+    fa_qos_leak_batch_begin(vtss_state);
+    for (port = VTSS_CHIP_PORT_CPU_0; port <= VTSS_CHIP_PORT_CPU_1 && rc == VTSS_RC_OK; port++) {
         /* CPU port shaper at layer 2 (kbps) */
         shaper.rate  = rate;       // kbps
         shaper.level = (4096 * 4); // 16 kbytes burst size
-        VTSS_RC(vtss_fa_qos_shaper_conf_set(vtss_state, &shaper, 2, port, 0, 0));
+        rc = vtss_fa_qos_shaper_conf_set(vtss_state, &shaper, 2, port, 0, 0);
 
         /* CPU queue shapers at layer 0, 1 FPS corresponds to 100 kbps */
-        for (queue = 0; queue < 8; queue++) {
+        for (queue = 0; queue < 8 && rc == VTSS_RC_OK; queue++) {
             se = FA_HSCH_L0_SE(port, queue);
             packet_rate = vtss_state->packet.rx_conf.queue[queue].rate;
             shaper.rate  = (packet_rate == VTSS_PACKET_RATE_DISABLED ? VTSS_BITRATE_DISABLED : packet_rate * 100);
             shaper.level = 4096;
-            VTSS_RC(vtss_fa_qos_shaper_conf_set(vtss_state, &shaper, 0, se, 0, 0));
-            REG_WR(VTSS_HSCH_SE_CFG(se), VTSS_F_HSCH_SE_CFG_SE_FRM_MODE(3));
+            if ((rc = vtss_fa_qos_shaper_conf_set(vtss_state, &shaper, 0, se, 0, 0)) == VTSS_RC_OK) {
+                REG_WR(VTSS_HSCH_SE_CFG(se), VTSS_F_HSCH_SE_CFG_SE_FRM_MODE(3));
+            }
         }
     }
+    VTSS_RC(fa_qos_leak_batch_end(vtss_state));
     VTSS_D("Exit");
-    return  VTSS_RC_OK;
+    return rc;
 }
 
 static vtss_rc fa_qos_status_get(vtss_state_t *vtss_state, vtss_qos_status_t *status)
@@ -2743,26 +2963,24 @@ static vtss_rc hold_qmaxsdu_configure(vtss_state_t *vtss_state,  u32 profile_idx
     return VTSS_RC_OK;
 }
 
-static vtss_rc gcl_port_profile_configure(vtss_state_t *vtss_state, u32 list_idx,
-                                          vtss_qos_tas_gce_t *gcl, u32 gcl_length,
-                                          const vtss_port_no_t port_no)
+/* Calculate the TAS_GCL_CTRL_CFG register value of all list entries */
+static void tas_gcl_ctrl_calc(vtss_state_t *vtss_state, u32 list_idx,
+                              vtss_qos_tas_gce_t *gcl, u32 gcl_length,
+                              const vtss_port_no_t port_no, u32 *ctrl_cfg)
 {
     u32  i, pindex;
     BOOL hold;
     u32  profile_idx = vtss_state->qos.tas.tas_lists[list_idx].profile_idx;
     u32  hold_profile_idx = vtss_state->qos.tas.tas_lists[list_idx].hold_profile_idx;
+    u32  hsch_pos = (5040 + 64 + VTSS_CHIP_PORT(port_no)); /* Default scheduler element when HQoS is not present */
 #if defined(VTSS_FEATURE_QOS_FRAME_PREEMPTION)
     u32  fp_enable_tx = (vtss_state->qos.fp.port_conf[port_no].enable_tx ? 1 : 0);
 #else
     u32  fp_enable_tx = FALSE;
 #endif
 
-    VTSS_D("gcl_port_profile_configure Enter  fp_enable_tx %u", fp_enable_tx);
-
-    /* Select the list */
-    REG_WRM(VTSS_HSCH_TAS_CFG_CTRL, VTSS_F_HSCH_TAS_CFG_CTRL_LIST_NUM(list_idx), VTSS_M_HSCH_TAS_CFG_CTRL_LIST_NUM);
+    VTSS_D("Enter  fp_enable_tx %u", fp_enable_tx);
 
-    /* Configure profile reference in the list elements */
     hold = FALSE;
     for (i = 0; i < gcl_length; ++i) {
         pindex = profile_idx;
@@ -2780,14 +2998,73 @@ static vtss_rc gcl_port_profile_configure(vtss_state_t *vtss_state, u32 list_idx
             hold = FALSE;
         }
 
+        ctrl_cfg[i] = VTSS_F_HSCH_TAS_GCL_CTRL_CFG_GATE_STATE(vtss_bool8_to_u8(gcl[i].gate_open)) |
+                      VTSS_F_HSCH_TAS_GCL_CTRL_CFG_PORT_PROFILE(pindex) |
+                      VTSS_F_HSCH_TAS_GCL_CTRL_CFG_HSCH_POS(hsch_pos);
+    }
+}
+
+/* Calculate the list entries and select the list. The TAS_CFG_CTRL value to use for selecting an entry is returned in 'cfg_ctrl' */
+static vtss_rc tas_gcl_select(vtss_state_t *vtss_state, u32 list_idx,
+                              vtss_qos_tas_gce_t *gcl, u32 gcl_length,
+                              const vtss_port_no_t port_no, u32 *ctrl_cfg, u32 *cfg_ctrl)
+{
+    if (gcl_length > VTSS_QOS_TAS_GCL_LEN_MAX) {
+        VTSS_E("Invalid GCL length %u", gcl_length);
+        return VTSS_RC_ERROR;
+    }
+
+    /* Calculate all entries before the download */
+    tas_gcl_ctrl_calc(vtss_state, list_idx, gcl, gcl_length, port_no, ctrl_cfg);
+
+    /* Select the list */
+    REG_WRM(VTSS_HSCH_TAS_CFG_CTRL, VTSS_F_HSCH_TAS_CFG_CTRL_LIST_NUM(list_idx), VTSS_M_HSCH_TAS_CFG_CTRL_LIST_NUM);
+    REG_RD(VTSS_HSCH_TAS_CFG_CTRL, cfg_ctrl);
+    *cfg_ctrl &= ~VTSS_M_HSCH_TAS_CFG_CTRL_GCL_ENTRY_NUM;
+    return VTSS_RC_OK;
+}
+
+/* Write the list entries */
+static vtss_rc tas_gcl_write(vtss_state_t *vtss_state, u32 list_idx,
+                             vtss_qos_tas_gce_t *gcl, u32 gcl_length,
+                             const vtss_port_no_t port_no)
+{
+    u32 i, cfg_ctrl, ctrl_cfg[VTSS_QOS_TAS_GCL_LEN_MAX];
+
+    VTSS_RC(tas_gcl_select(vtss_state, list_idx, gcl, gcl_length, port_no, ctrl_cfg, &cfg_ctrl));
+
+    for (i = 0; i < gcl_length; ++i) {
         /* Select the list entry */
-        REG_WRM(VTSS_HSCH_TAS_CFG_CTRL, VTSS_F_HSCH_TAS_CFG_CTRL_GCL_ENTRY_NUM(i), VTSS_M_HSCH_TAS_CFG_CTRL_GCL_ENTRY_NUM); /* The GCL_ENTRY_NUM is relative to the LIST_BASE_ADDR that is accessed latest  */
+        REG_WR(VTSS_HSCH_TAS_CFG_CTRL, cfg_ctrl | VTSS_F_HSCH_TAS_CFG_CTRL_GCL_ENTRY_NUM(i)); /* The GCL_ENTRY_NUM is relative to the LIST_BASE_ADDR that is accessed latest  */
+
+        /* Configure the list entry */
+        REG_WR(VTSS_HSCH_TAS_GCL_CTRL_CFG, ctrl_cfg[i]);
+        REG_WR(VTSS_HSCH_TAS_GCL_TIME_CFG, gcl[i].time_interval);
+    }
+    return VTSS_RC_OK;
+}
+
+#if defined(VTSS_FEATURE_QOS_FRAME_PREEMPTION)
+/* Update the profile reference of the list entries. The gate state and scheduler element of the entries are not changed */
+static vtss_rc gcl_port_profile_configure(vtss_state_t *vtss_state, u32 list_idx,
+                                          vtss_qos_tas_gce_t *gcl, u32 gcl_length,
+                                          const vtss_port_no_t port_no)
+{
+    u32 i, cfg_ctrl, ctrl_cfg[VTSS_QOS_TAS_GCL_LEN_MAX];
+
+    VTSS_RC(tas_gcl_select(vtss_state, list_idx, gcl, gcl_length, port_no, ctrl_cfg, &cfg_ctrl));
+
+    /* Configure profile reference in the list elements */
+    for (i = 0; i < gcl_length; ++i) {
+        /* Select the list entry */
+        REG_WR(VTSS_HSCH_TAS_CFG_CTRL, cfg_ctrl | VTSS_F_HSCH_TAS_CFG_CTRL_GCL_ENTRY_NUM(i)); /* The GCL_ENTRY_NUM is relative to the LIST_BASE_ADDR that is accessed latest  */
 
         /* Configure the profile reference */
-        REG_WRM(VTSS_HSCH_TAS_GCL_CTRL_CFG, VTSS_F_HSCH_TAS_GCL_CTRL_CFG_PORT_PROFILE(pindex), VTSS_M_HSCH_TAS_GCL_CTRL_CFG_PORT_PROFILE);   /* Default scheduler element when HQoS is not present */
+        REG_WRM(VTSS_HSCH_TAS_GCL_CTRL_CFG, ctrl_cfg[i], VTSS_M_HSCH_TAS_GCL_CTRL_CFG_PORT_PROFILE);
     }
     return VTSS_RC_OK;
 }
+#endif
 
 static vtss_rc tas_list_start(vtss_state_t *vtss_state, const vtss_port_no_t port_no,
                               u32 list_idx, u32 obsolete_list_idx,
@@ -2857,24 +3134,15 @@ static vtss_rc tas_list_start(vtss_state_t *vtss_state, const vtss_port_no_t por
         }
     }
 
-    /* Configure the list elements */
+    /* Configure the list elements, including the profile reference that depends on Frame Preemption enable/disable */
+    if (tas_gcl_write(vtss_state, list_idx, gcl, gcl_length, port_no) != VTSS_RC_OK) {
+        VTSS_D("tas_gcl_write failed");
+        return VTSS_RC_ERROR;
+    }
     for (i = 0; i < gcl_length; ++i) {
-        /* Select the list entry */
-        REG_WRM(VTSS_HSCH_TAS_CFG_CTRL, VTSS_F_HSCH_TAS_CFG_CTRL_GCL_ENTRY_NUM(i), VTSS_M_HSCH_TAS_CFG_CTRL_GCL_ENTRY_NUM); /* The GCL_ENTRY_NUM is relative to the LIST_BASE_ADDR that is accessed latest  */
-
-        /* Configure the list entry */
-        REG_WR(VTSS_HSCH_TAS_GCL_CTRL_CFG, VTSS_F_HSCH_TAS_GCL_CTRL_CFG_GATE_STATE(vtss_bool8_to_u8(gcl[i].gate_open)) |
-                                           VTSS_F_HSCH_TAS_GCL_CTRL_CFG_HSCH_POS(5040 + 64 + chip_port));   /* Default scheduler element when HQoS is not present */
-        REG_WR(VTSS_HSCH_TAS_GCL_TIME_CFG, gcl[i].time_interval);
-
         /* Calculate the sum of time intervals */
         time_interval_sum += gcl[i].time_interval;
     }
-    /* Configure the list elements profile reference. This is depending on Frame Preemption enable/disable */
-    if (gcl_port_profile_configure(vtss_state, list_idx, gcl, gcl_length, port_no) != VTSS_RC_OK) {
-        VTSS_D("gcl_port_profile_configure failed");
-        return VTSS_RC_ERROR;
-    }
 
     /* Check if the sum of intervals are larger that the requeste cycle time */
     if ((time_interval_sum > cycle_time) || (cycle_time > VTSS_QOS_TAS_CT_MAX) || (cycle_time == 0)) {
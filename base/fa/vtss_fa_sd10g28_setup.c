@@ -23,17 +23,12 @@
 #include "vtss_fa_inc.h"
 
 
-vtss_rc  vtss_ant_sd10g28_cmu_reg_cfg(vtss_state_t *vtss_state, u32 cmu_num) {
-    vtss_rc rc = VTSS_RC_OK;
-    u32 value;
+/* CMU configuration, followed by a 20 ms wait */
+static vtss_rc vtss_ant_sd10g28_cmu_reg_cfg_start(vtss_state_t *vtss_state, u32 cmu_num) {
 	u32 cmu_tgt = VTSS_TO_SD_CMU(cmu_num);
 	u32 cmu_cfg_tgt = VTSS_TO_SD_CMU_CFG(cmu_num);
     u32 spd10g = 1;
 
-    if (vtss_state->port.cmu_enable_mask & VTSS_BIT(cmu_num)) {
-        return VTSS_RC_OK; // Already enabled
-    }
-
     if (cmu_num == 1 || cmu_num == 4 || cmu_num == 7 || cmu_num == 10 || cmu_num == 13) {
         spd10g = 0;
     }
@@ -114,7 +109,12 @@ vtss_rc  vtss_ant_sd10g28_cmu_reg_cfg(vtss_state_t *vtss_state, u32 cmu_num) {
                 VTSS_F_SD10G_CMU_TARGET_CMU_0C_CFG_RSEL_2_0(6),
                 VTSS_M_SD10G_CMU_TARGET_CMU_0C_CFG_RSEL_2_0);
 
-    VTSS_MSLEEP(20);
+  return VTSS_RC_OK;
+}
+
+/* CMU PLL reset, followed by a 20 ms wait */
+static vtss_rc vtss_ant_sd10g28_cmu_reg_cfg_pll(vtss_state_t *vtss_state, u32 cmu_num) {
+	u32 cmu_tgt = VTSS_TO_SD_CMU(cmu_num);
 
     REG_WRM(VTSS_SD10G_CMU_TARGET_CMU_44(cmu_tgt),
                 VTSS_F_SD10G_CMU_TARGET_CMU_44_R_PLL_RSTN(0),
@@ -124,7 +124,14 @@ vtss_rc  vtss_ant_sd10g28_cmu_reg_cfg(vtss_state_t *vtss_state, u32 cmu_num) {
                 VTSS_F_SD10G_CMU_TARGET_CMU_44_R_PLL_RSTN(1),
                 VTSS_M_SD10G_CMU_TARGET_CMU_44_R_PLL_RSTN);
 
-    VTSS_MSLEEP(20);
+  return VTSS_RC_OK;
+}
+
+/* CMU PLL lock check */
+static vtss_rc vtss_ant_sd10g28_cmu_reg_cfg_done(vtss_state_t *vtss_state, u32 cmu_num) {
+    vtss_rc rc = VTSS_RC_OK;
+    u32 value;
+	u32 cmu_tgt = VTSS_TO_SD_CMU(cmu_num);
 
     REG_RD(VTSS_SD10G_CMU_TARGET_CMU_E0(cmu_tgt), &value);
     value = VTSS_X_SD10G_CMU_TARGET_CMU_E0_PLL_LOL_UDL(value);
@@ -146,32 +153,63 @@ vtss_rc  vtss_ant_sd10g28_cmu_reg_cfg(vtss_state_t *vtss_state, u32 cmu_num) {
   return rc;
 }
 
-static vtss_rc  vtss_ant_sd10g28_reg_cfg(vtss_state_t *vtss_state, vtss_sd10g28_setup_struct_t *const res_struct, vtss_port_no_t port_no) {
-    vtss_rc rc = VTSS_RC_OK;
-    u32 value;
-    u32 sd_lane_tgt;
-    u32 sd_tgt;
-    u32 indx = vtss_fa_port2sd_indx(vtss_state, port_no);
-    u32 cmu_num = vtss_fa_sd10g28_get_cmu(vtss_state, res_struct->cmu_sel[0], port_no);
+/* The CMU is shared by several lanes and enabled by the first lane using it in stage 0-2 of the lane setup.
+   The stages in progress are tracked per CMU, so a CMU is configured once when the lanes are set up together. */
+vtss_rc  vtss_ant_sd10g28_cmu_reg_cfg(vtss_state_t *vtss_state, u32 cmu_num, u32 stage, u32 *wait_msec) {
+    u32 bit = VTSS_BIT(cmu_num);
 
-    if (vtss_ant_sd10g28_cmu_reg_cfg(vtss_state, cmu_num) != VTSS_RC_OK) {
-        VTSS_E("Could not enable CMU:%d\n", cmu_num);
+    if (vtss_state->port.cmu_enable_mask & bit) {
+        return VTSS_RC_OK; // Already enabled
     }
 
+    switch (stage) {
+    case 0:
+        if ((vtss_state->port.cmu_cfg_mask | vtss_state->port.cmu_pll_mask) & bit) {
+            break; // Enabling in progress
+        }
+        vtss_state->port.cmu_cfg_mask |= bit;
+        VTSS_RC(vtss_ant_sd10g28_cmu_reg_cfg_start(vtss_state, cmu_num));
+        *wait_msec = 20;
+        break;
+    case 1:
+        if (vtss_state->port.cmu_cfg_mask & bit) {
+            vtss_state->port.cmu_cfg_mask &= ~bit;
+            vtss_state->port.cmu_pll_mask |= bit;
+            VTSS_RC(vtss_ant_sd10g28_cmu_reg_cfg_pll(vtss_state, cmu_num));
+            *wait_msec = 20;
+        }
+        break;
+    case 2:
+        if (vtss_state->port.cmu_pll_mask & bit) {
+            vtss_state->port.cmu_pll_mask &= ~bit;
+            return vtss_ant_sd10g28_cmu_reg_cfg_done(vtss_state, cmu_num);
+        }
+        break;
+    default:
+        break;
+    }
+    return VTSS_RC_OK;
+}
+
+static void vtss_ant_sd10g28_lane_tgt(vtss_state_t *vtss_state, vtss_sd10g28_setup_struct_t *const res_struct, vtss_port_no_t port_no,
+                                      u32 *sd_tgt, u32 *sd_lane_tgt) {
+    u32 indx = vtss_fa_port2sd_indx(vtss_state, port_no);
+
     if(res_struct->is_6g[0] == 1) {
-        sd_tgt = VTSS_TO_SD6G_LANE(indx);
-        sd_lane_tgt = VTSS_TO_SD_LANE(indx);
+        *sd_tgt = VTSS_TO_SD6G_LANE(indx);
+        *sd_lane_tgt = VTSS_TO_SD_LANE(indx);
     } else {
-        sd_tgt = VTSS_TO_SD10G_LANE(indx);
-        sd_lane_tgt = VTSS_TO_SD_LANE(indx+VTSS_SERDES_10G_START);
-    } 
+        *sd_tgt = VTSS_TO_SD10G_LANE(indx);
+        *sd_lane_tgt = VTSS_TO_SD_LANE(indx+VTSS_SERDES_10G_START);
+    }
+}
 
-/* Note: SerDes SD10G_LANE_1 is configured in 10G_LAN mode */
-    REG_WRM(VTSS_SD_LANE_TARGET_SD_LANE_CFG(sd_lane_tgt),
-                VTSS_F_SD_LANE_TARGET_SD_LANE_CFG_EXT_CFG_RST(1),
-                VTSS_M_SD_LANE_TARGET_SD_LANE_CFG_EXT_CFG_RST);
+/* Lane configuration, followed by a 3 ms wait for the PMA reset */
+static vtss_rc  vtss_ant_sd10g28_reg_cfg_lane(vtss_state_t *vtss_state, vtss_sd10g28_setup_struct_t *const res_struct, vtss_port_no_t port_no) {
+    u32 sd_lane_tgt;
+    u32 sd_tgt;
 
-    VTSS_MSLEEP(1);
+    vtss_ant_sd10g28_lane_tgt(vtss_state, res_struct, port_no, &sd_tgt, &sd_lane_tgt);
 
     REG_WRM(VTSS_SD_LANE_TARGET_SD_LANE_CFG(sd_lane_tgt),
                 VTSS_F_SD_LANE_TARGET_SD_LANE_CFG_EXT_CFG_RST(0),
@@ -469,7 +507,17 @@ static vtss_rc  vtss_ant_sd10g28_reg_cfg(vtss_state_t *vtss_state, vtss_sd10g28_
                 VTSS_F_SD_LANE_TARGET_MISC_MUX_ENA(res_struct->fx_100[0]),
                 VTSS_M_SD_LANE_TARGET_MISC_MUX_ENA);
 
-    VTSS_MSLEEP(3);
+  return VTSS_RC_OK;
+}
+
+/* Lane status check and release of the SER/DES reset */
+static vtss_rc  vtss_ant_sd10g28_reg_cfg_done(vtss_state_t *vtss_state, vtss_sd10g28_setup_struct_t *const res_struct, vtss_port_no_t port_no) {
+    vtss_rc rc = VTSS_RC_OK;
+    u32 value;
+    u32 sd_lane_tgt;
+    u32 sd_tgt;
+
+    vtss_ant_sd10g28_lane_tgt(vtss_state, res_struct, port_no, &sd_tgt, &sd_lane_tgt);
 
     REG_RD(VTSS_SD_LANE_TARGET_SD_LANE_STAT(sd_lane_tgt), &value);
     value = VTSS_X_SD_LANE_TARGET_SD_LANE_STAT_PMA_RST_DONE(value);
@@ -493,14 +541,58 @@ static vtss_rc  vtss_ant_sd10g28_reg_cfg(vtss_state_t *vtss_state, vtss_sd10g28_
   return rc;
 }
 
-vtss_rc vtss_ant_sd10g28_setup_lane(vtss_state_t *vtss_state, const vtss_sd10g28_setup_args_t config, vtss_port_no_t port_no) {
+/* The register setup is split in stages at its waits, so lanes configured together can share the waits:
+   Stage 0-2: CMU enable, see vtss_ant_sd10g28_cmu_reg_cfg()
+   Stage 3: Configuration reset, wait 1 ms
+   Stage 4: Lane configuration, wait 3 ms
+   Stage 5: Status check and SER/DES reset release */
+static vtss_rc  vtss_ant_sd10g28_reg_cfg(vtss_state_t *vtss_state, vtss_sd10g28_setup_struct_t *const res_struct, vtss_port_no_t port_no,
+                                         u32 stage, u32 *wait_msec) {
+    u32 sd_lane_tgt;
+    u32 sd_tgt;
+    u32 cmu_num = vtss_fa_sd10g28_get_cmu(vtss_state, res_struct->cmu_sel[0], port_no);
+
+    vtss_ant_sd10g28_lane_tgt(vtss_state, res_struct, port_no, &sd_tgt, &sd_lane_tgt);
+
+    switch (stage) {
+    case 0:
+    case 1:
+    case 2:
+        if (vtss_ant_sd10g28_cmu_reg_cfg(vtss_state, cmu_num, stage, wait_msec) != VTSS_RC_OK) {
+            VTSS_E("Could not enable CMU:%d\n", cmu_num);
+        }
+        break;
+    case 3:
+/* Note: SerDes SD10G_LANE_1 is configured in 10G_LAN mode */
+        REG_WRM(VTSS_SD_LANE_TARGET_SD_LANE_CFG(sd_lane_tgt),
+                VTSS_F_SD_LANE_TARGET_SD_LANE_CFG_EXT_CFG_RST(1),
+                VTSS_M_SD_LANE_TARGET_SD_LANE_CFG_EXT_CFG_RST);
+        *wait_msec = 1;
+        break;
+    case 4:
+        VTSS_RC(vtss_ant_sd10g28_reg_cfg_lane(vtss_state, res_struct, port_no));
+        *wait_msec = 3;
+        break;
+    case 5:
+        return vtss_ant_sd10g28_reg_cfg_done(vtss_state, res_struct, port_no);
+    default:
+        break;
+    }
+    return VTSS_RC_OK;
+}
+
+vtss_rc vtss_ant_sd10g28_setup_lane_stage(vtss_state_t *vtss_state, const vtss_sd10g28_setup_args_t config, vtss_port_no_t port_no,
+                                          u32 stage, u32 *wait_msec) {
     vtss_sd10g28_setup_struct_t calc_results = {};
     vtss_rc rc;
-    VTSS_D("This function is generated with UTE based on TAG: temp");
+    if (stage == 0) {
+        VTSS_D("This function is generated with UTE based on TAG: temp");
+    }
 
+    *wait_msec = 0;
     rc = vtss_calc_sd10g28_setup_lane(config, &calc_results);
     if(rc == VTSS_RC_OK) {
-        rc |= vtss_ant_sd10g28_reg_cfg(vtss_state, &calc_results, port_no);
+        rc |= vtss_ant_sd10g28_reg_cfg(vtss_state, &calc_results, port_no, stage, wait_msec);
     }
     return rc;
 }
@@ -23,9 +23,8 @@
 #include "vtss_fa_inc.h"
 
 
-static vtss_rc vtss_ant_sd25g28_reg_cfg(vtss_state_t *vtss_state, vtss_sd25g28_setup_struct_t *const res_struct, vtss_port_no_t port_no) {
-    vtss_rc rc = VTSS_RC_OK;
-    u32 value;
+/* Lane configuration, ending with the CDR in reset */
+static vtss_rc vtss_ant_sd25g28_reg_cfg_lane(vtss_state_t *vtss_state, vtss_sd25g28_setup_struct_t *const res_struct, vtss_port_no_t port_no) {
     u32 sd_lane_tgt;
     u32 sd25g_tgt;
 
@@ -33,14 +32,7 @@ static vtss_rc vtss_ant_sd25g28_reg_cfg(vtss_state_t *vtss_state, vtss_sd25g28_s
     sd_lane_tgt = VTSS_TO_SD_LANE(indx+VTSS_SERDES_25G_START);
     sd25g_tgt = VTSS_TO_SD25G_LANE(indx);
 
-/* Note: SerDes SD_LANE_25 is configured in 25G_LAN mode */
     if( res_struct->reg_rst[0] == 1) {
-    REG_WRM(VTSS_SD25G_CFG_TARGET_SD_LANE_CFG(sd_lane_tgt),
-                VTSS_F_SD25G_CFG_TARGET_SD_LANE_CFG_EXT_CFG_RST(1),
-                VTSS_M_SD25G_CFG_TARGET_SD_LANE_CFG_EXT_CFG_RST);
-
-    VTSS_MSLEEP(1);
-
     REG_WRM(VTSS_SD25G_CFG_TARGET_SD_LANE_CFG(sd_lane_tgt),
                 VTSS_F_SD25G_CFG_TARGET_SD_LANE_CFG_EXT_CFG_RST(0),
                 VTSS_M_SD25G_CFG_TARGET_SD_LANE_CFG_EXT_CFG_RST);
@@ -415,13 +407,19 @@ static vtss_rc vtss_ant_sd25g28_reg_cfg(vtss_state_t *vtss_state, vtss_sd25g28_s
                 VTSS_F_SD25G_TARGET_LANE_1C_LN_CFG_CDR_RSTN(0),
                 VTSS_M_SD25G_TARGET_LANE_1C_LN_CFG_CDR_RSTN);
 
-    VTSS_MSLEEP(1);
+  return VTSS_RC_OK;
+}
 
-    REG_WRM(VTSS_SD25G_TARGET_LANE_1C(sd25g_tgt),
-                VTSS_F_SD25G_TARGET_LANE_1C_LN_CFG_CDR_RSTN(1),
-                VTSS_M_SD25G_TARGET_LANE_1C_LN_CFG_CDR_RSTN);
+/* Lane status check and release of the SER/DES reset */
+static vtss_rc vtss_ant_sd25g28_reg_cfg_done(vtss_state_t *vtss_state, vtss_sd25g28_setup_struct_t *const res_struct, vtss_port_no_t port_no) {
+    vtss_rc rc = VTSS_RC_OK;
+    u32 value;
+    u32 sd_lane_tgt;
+    u32 sd25g_tgt;
 
-    VTSS_MSLEEP(10);
+    u32 indx = vtss_fa_port2sd_indx(vtss_state, port_no);
+    sd_lane_tgt = VTSS_TO_SD_LANE(indx+VTSS_SERDES_25G_START);
+    sd25g_tgt = VTSS_TO_SD25G_LANE(indx);
 
     REG_WRM(VTSS_SD25G_TARGET_CMU_FF(sd25g_tgt),
                 VTSS_F_SD25G_TARGET_CMU_FF_REGISTER_TABLE_INDEX(0xff),
@@ -479,14 +477,61 @@ static vtss_rc vtss_ant_sd25g28_reg_cfg(vtss_state_t *vtss_state, vtss_sd25g28_s
   return rc;
 }
 
-vtss_rc vtss_ant_sd25g28_setup_lane(vtss_state_t *vtss_state, const vtss_sd25g28_setup_args_t config, vtss_port_no_t port_no) {
+/* The register setup is split in stages at its waits, so lanes configured together can share the waits.
+   The stages are aligned with the SD10G28 setup, which uses stage 0-2 for the CMU:
+   Stage 2: Configuration reset, wait 1 ms
+   Stage 3: Lane configuration and CDR reset, wait 1 ms
+   Stage 4: CDR reset release, wait 10 ms
+   Stage 5: Status check and SER/DES reset release */
+static vtss_rc vtss_ant_sd25g28_reg_cfg(vtss_state_t *vtss_state, vtss_sd25g28_setup_struct_t *const res_struct, vtss_port_no_t port_no,
+                                        u32 stage, u32 *wait_msec) {
+    u32 sd_lane_tgt;
+    u32 sd25g_tgt;
+
+    u32 indx = vtss_fa_port2sd_indx(vtss_state, port_no);
+    sd_lane_tgt = VTSS_TO_SD_LANE(indx+VTSS_SERDES_25G_START);
+    sd25g_tgt = VTSS_TO_SD25G_LANE(indx);
+
+    switch (stage) {
+    case 2:
+/* Note: SerDes SD_LANE_25 is configured in 25G_LAN mode */
+        if( res_struct->reg_rst[0] == 1) {
+            REG_WRM(VTSS_SD25G_CFG_TARGET_SD_LANE_CFG(sd_lane_tgt),
+                    VTSS_F_SD25G_CFG_TARGET_SD_LANE_CFG_EXT_CFG_RST(1),
+                    VTSS_M_SD25G_CFG_TARGET_SD_LANE_CFG_EXT_CFG_RST);
+            *wait_msec = 1;
+        }
+        break;
+    case 3:
+        VTSS_RC(vtss_ant_sd25g28_reg_cfg_lane(vtss_state, res_struct, port_no));
+        *wait_msec = 1;
+        break;
+    case 4:
+        REG_WRM(VTSS_SD25G_TARGET_LANE_1C(sd25g_tgt),
+                VTSS_F_SD25G_TARGET_LANE_1C_LN_CFG_CDR_RSTN(1),
+                VTSS_M_SD25G_TARGET_LANE_1C_LN_CFG_CDR_RSTN);
+        *wait_msec = 10;
+        break;
+    case 5:
+        return vtss_ant_sd25g28_reg_cfg_done(vtss_state, res_struct, port_no);
+    default:
+        break;
+    }
+    return VTSS_RC_OK;
+}
+
+vtss_rc vtss_ant_sd25g28_setup_lane_stage(vtss_state_t *vtss_state, const vtss_sd25g28_setup_args_t config, vtss_port_no_t port_no,
+                                          u32 stage, u32 *wait_msec) {
     vtss_sd25g28_setup_struct_t calc_results;
     vtss_rc rc;
-    VTSS_D("This function is generated with UTE based on TAG: temp");
+    if (stage == 0) {
+        VTSS_D("This function is generated with UTE based on TAG: temp");
+    }
 
+    *wait_msec = 0;
     rc = vtss_calc_sd25g28_setup_lane(config, &calc_results);
     if(rc == VTSS_RC_OK) {
-        rc |= vtss_ant_sd25g28_reg_cfg(vtss_state, &calc_results, port_no);
+        rc |= vtss_ant_sd25g28_reg_cfg(vtss_state, &calc_results, port_no, stage, wait_msec);
     }
     return rc;
 }
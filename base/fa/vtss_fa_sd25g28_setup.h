@@ -22,7 +22,8 @@
 #if defined(VTSS_ARCH_SPARX5)
 
 #include "vtss_fa_inc.h"
-vtss_rc vtss_ant_sd25g28_setup_lane(vtss_state_t *vtss_state, const vtss_sd25g28_setup_args_t config, vtss_port_no_t port_no);
+vtss_rc vtss_ant_sd25g28_setup_lane_stage(vtss_state_t *vtss_state, const vtss_sd25g28_setup_args_t config, vtss_port_no_t port_no,
+                                          u32 stage, u32 *wait_msec);
 
 #endif
 #endif
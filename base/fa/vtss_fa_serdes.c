@@ -3462,7 +3462,8 @@ u32 vtss_fa_sd_lane_indx(vtss_state_t *vtss_state, vtss_port_no_t port_no)
 }
 
 
-static vtss_rc fa_sd25g_cfg(vtss_state_t *vtss_state, vtss_port_no_t port_no, vtss_serdes_mode_t mode)
+static vtss_rc fa_sd25g_cfg(vtss_state_t *vtss_state, vtss_port_no_t port_no, vtss_serdes_mode_t mode,
+                            u32 stage, u32 *wait_msec)
 {
     vtss_sd25g28_setup_args_t sd_cfg = {0};
     vtss_port_speed_t speed = vtss_state->port.conf[port_no].speed;
@@ -3537,7 +3538,7 @@ static vtss_rc fa_sd25g_cfg(vtss_state_t *vtss_state, vtss_port_no_t port_no, vt
         }
     }
 
-    if (vtss_ant_sd25g28_setup_lane(vtss_state, sd_cfg, port_no) != VTSS_RC_OK) {
+    if (vtss_ant_sd25g28_setup_lane_stage(vtss_state, sd_cfg, port_no, stage, wait_msec) != VTSS_RC_OK) {
         VTSS_E("Could not configure Serdes mode (%d) at port:%d",mode,port_no);
         return VTSS_RC_ERROR;
     }
@@ -3545,7 +3546,8 @@ static vtss_rc fa_sd25g_cfg(vtss_state_t *vtss_state, vtss_port_no_t port_no, vt
     return VTSS_RC_OK;
 }
 
-static vtss_rc fa_sd10g_cfg(vtss_state_t *vtss_state, vtss_port_no_t port_no,  vtss_serdes_mode_t mode, u32 sd_type)
+static vtss_rc fa_sd10g_cfg(vtss_state_t *vtss_state, vtss_port_no_t port_no,  vtss_serdes_mode_t mode, u32 sd_type,
+                            u32 stage, u32 *wait_msec)
 {
     vtss_port_speed_t speed = vtss_state->port.conf[port_no].speed;
     vtss_sd10g28_setup_args_t sd_cfg = {0};
@@ -3617,7 +3619,7 @@ static vtss_rc fa_sd10g_cfg(vtss_state_t *vtss_state, vtss_port_no_t port_no,  v
             return VTSS_RC_ERROR;
         }
     }
-    if (vtss_ant_sd10g28_setup_lane(vtss_state, sd_cfg, port_no) != VTSS_RC_OK) {
+    if (vtss_ant_sd10g28_setup_lane_stage(vtss_state, sd_cfg, port_no, stage, wait_msec) != VTSS_RC_OK) {
         VTSS_E("Could not configure Serdes mode (%d) at port:%d",mode,port_no);
         return VTSS_RC_ERROR;
     }
@@ -3655,21 +3657,42 @@ static vtss_rc vtss_fa_sd_board_settings(vtss_state_t *vtss_state, vtss_port_no_
     return rc;
 }
 
-vtss_rc vtss_fa_sd_cfg(vtss_state_t *vtss_state, vtss_port_no_t port_no,  vtss_serdes_mode_t mode)
+/* Run one stage of the Serdes setup. The caller must wait 'wait_msec' before the next stage.
+   Setting up several Serdes lanes stage by stage allows them to share the waits. */
+vtss_rc vtss_fa_sd_cfg_stage(vtss_state_t *vtss_state, vtss_port_no_t port_no,  vtss_serdes_mode_t mode,
+                             u32 stage, u32 *wait_msec)
 {
     u32 sd_indx, sd_type;
 
+    *wait_msec = 0;
+
     /* Map API port to Serdes instance */
     VTSS_RC(vtss_fa_port2sd(vtss_state, port_no, &sd_indx, &sd_type));
 
     if (sd_type == FA_SERDES_TYPE_25G) {
-        VTSS_RC(fa_sd25g_cfg(vtss_state, port_no,  mode));
+        VTSS_RC(fa_sd25g_cfg(vtss_state, port_no,  mode, stage, wait_msec));
     } else {
-        VTSS_RC(fa_sd10g_cfg(vtss_state, port_no,  mode, sd_type));
+        VTSS_RC(fa_sd10g_cfg(vtss_state, port_no,  mode, sd_type, stage, wait_msec));
+    }
+
+    if (stage == FA_SD_SETUP_STAGES - 1) {
+        /*  Apply board specific TX equalizer settings */
+        VTSS_RC(vtss_fa_sd_board_settings(vtss_state, port_no, sd_indx, sd_type));
     }
 
-    /*  Apply board specific TX equalizer settings */
-    VTSS_RC(vtss_fa_sd_board_settings(vtss_state, port_no, sd_indx, sd_type));
+    return VTSS_RC_OK;
+}
+
+vtss_rc vtss_fa_sd_cfg(vtss_state_t *vtss_state, vtss_port_no_t port_no,  vtss_serdes_mode_t mode)
+{
+    u32 stage, wait_msec;
+
+    for (stage = 0; stage < FA_SD_SETUP_STAGES; stage++) {
+        VTSS_RC(vtss_fa_sd_cfg_stage(vtss_state, port_no, mode, stage, &wait_msec));
+        if (wait_msec != 0) {
+            VTSS_PROF_MSLEEP(wait_msec);
+        }
+    }
 
     return VTSS_RC_OK;
 }
@@ -544,20 +544,14 @@ static vtss_rc fa_ts_internal_mode_set(vtss_state_t *vtss_state)
 static u32 api_port(vtss_state_t *vtss_state, u32 chip_port)
 {
     u32 port_no;
-    int found = 0;
-    /* Map from chip port to API port */
+
+    /* Map from chip port to API port using the table built at port map time */
     if (chip_port == VTSS_CHIP_PORT_CPU) {
         port_no = VTSS_CHIP_PORT_CPU;
-    } else {
-        for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
-            if (VTSS_CHIP_PORT(port_no) == chip_port) {
-                found = 1;
-                break;
-            }
-        }
-        if (!found) {
-            VTSS_E("unknown chip port: %u, port_no: %d", chip_port, port_no);
-        }
+    } else if (chip_port >= VTSS_TS_CHIP_PORT_ARRAY_SIZE ||
+               (port_no = vtss_state->ts.chip_port_map[chip_port]) == VTSS_PORT_NO_NONE) {
+        VTSS_E("unknown chip port: %u", chip_port);
+        port_no = VTSS_PORT_NO_NONE;
     }
     return port_no;
 }
@@ -1734,8 +1728,14 @@ vtss_rc vtss_fa_ts_init(vtss_state_t *vtss_state, vtss_init_cmd_t cmd)
         VTSS_RC(fa_ts_init(vtss_state));
         break;
     case VTSS_INIT_CMD_PORT_MAP:
+        for (port = 0; port < VTSS_TS_CHIP_PORT_ARRAY_SIZE; port++) {
+            state->chip_port_map[port] = VTSS_PORT_NO_NONE;
+        }
         for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
             port = VTSS_CHIP_PORT(port_no);
+            if (port < VTSS_TS_CHIP_PORT_ARRAY_SIZE) {
+                state->chip_port_map[port] = port_no;
+            }
 
             /* Initialize the PTP Port ID port number. This is done anyway in the jr2_ts_operation_mode_set() function but this is only called from AIL in case of changes in mode or domain. */
             REG_WRM(VTSS_ANA_ACL_PTP_CFG(port), VTSS_F_ANA_ACL_PTP_CFG_PTP_PORT_NUM(port_no+1), VTSS_M_ANA_ACL_PTP_CFG_PTP_PORT_NUM);
@@ -41,6 +41,8 @@ typedef struct {
     u32 counter;                     /* CNT_DAT */
     u32 tg;                          /* TG_DAT */
     u32 type;                        /* Action type */
+    u32 entry_bits;                  /* Entry/mask bits processed by fa_vcap_entry_cmd() */
+    u32 action_bits;                 /* Action bits processed by fa_vcap_entry_cmd() */
 
     /* Debug print fields */
     BOOL                is_action;
@@ -619,9 +621,60 @@ static vtss_rc fa_vcap_entry_cmd(vtss_state_t *vtss_state,
             VTSS_RC(fa_vcap_cmd(vtss_state, &info));
         }
     } /* Address loop */
+    data->entry_bits = entry_offs;
+    data->action_bits = action_offs;
     return VTSS_RC_OK;
 }
 
+#if defined(VTSS_FEATURE_WARM_START)
+static BOOL fa_vcap_bits_changed(const u32 *cur, const u32 *data, u32 bits)
+{
+    u32 offs, w;
+
+    for (offs = 0; offs < bits; offs += w) {
+        w = MIN(32, bits - offs);
+        if (vtss_bs_get(cur, offs, w) != vtss_bs_get(data, offs, w)) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/* Warm start synchronization: Check if entry differs from the chip, ignoring the counter */
+static vtss_rc fa_vcap_entry_changed(vtss_state_t *vtss_state, fa_vcap_data_t *data, u32 addr, BOOL *changed)
+{
+    fa_vcap_data_t cur;
+
+    VTSS_MEMSET(&cur, 0, sizeof(cur));
+    cur.vcap_type = data->vcap_type;
+    VTSS_RC(fa_vcap_entry_cmd(vtss_state, &cur, addr, data->tg, FA_VCAP_CMD_READ,
+                              FA_VCAP_SEL_ENTRY | FA_VCAP_SEL_ACTION));
+
+    /* With the same TG and action type, the bit widths read are the widths written */
+    *changed = (cur.tg != data->tg || cur.type != data->type ||
+                fa_vcap_bits_changed(cur.entry, data->entry, cur.entry_bits) ||
+                fa_vcap_bits_changed(cur.mask, data->mask, cur.entry_bits) ||
+                fa_vcap_bits_changed(cur.action, data->action, cur.action_bits));
+    return VTSS_RC_OK;
+}
+#endif /* VTSS_FEATURE_WARM_START */
+
+/* Write full entry. During warm start synchronization, unchanged entries are skipped, keeping the counter */
+static vtss_rc fa_vcap_entry_set(vtss_state_t *vtss_state, fa_vcap_data_t *data, u32 addr)
+{
+#if defined(VTSS_FEATURE_WARM_START)
+    BOOL changed;
+
+    if (vtss_state->sync_active) {
+        VTSS_RC(fa_vcap_entry_changed(vtss_state, data, addr, &changed));
+        if (!vtss_cmn_sync_changed(vtss_state, changed)) {
+            return VTSS_RC_OK;
+        }
+    }
+#endif /* VTSS_FEATURE_WARM_START */
+    return fa_vcap_entry_cmd(vtss_state, data, addr, data->tg, FA_VCAP_CMD_WRITE, FA_VCAP_SEL_ALL);
+}
+
 static vtss_rc fa_vcap_entry_del(vtss_state_t *vtss_state, vtss_vcap_type_t type, vtss_vcap_idx_t *idx)
 {
     fa_vcap_type_t             bank = fa_vcap_type(type);
@@ -1771,7 +1824,7 @@ static vtss_rc fa_clm_entry_add(vtss_state_t *vtss_state,
     /* Update action fields based on ingress QoS mapping */
     fa_clm_action_update(vtss_state, data, is1);
 
-    return fa_vcap_entry_cmd(vtss_state, data, addr, data->tg, FA_VCAP_CMD_WRITE, FA_VCAP_SEL_ALL);
+    return fa_vcap_entry_set(vtss_state, data, addr);
 }
 
 static vtss_rc fa_clm_entry_update(vtss_state_t *vtss_state,
@@ -2316,7 +2369,7 @@ static vtss_rc fa_lpm_entry_add(vtss_state_t *vtss_state, vtss_vcap_idx_t *idx,
     }
     FA_ACT_SET(LPM, X1_TYPE, action->type);
 
-    return fa_vcap_entry_cmd(vtss_state, data, addr, data->tg, FA_VCAP_CMD_WRITE, FA_VCAP_SEL_ALL);
+    return fa_vcap_entry_set(vtss_state, data, addr);
 }
 
 static vtss_rc fa_lpm_entry_del(vtss_state_t *vtss_state, vtss_vcap_idx_t *idx)
@@ -2959,7 +3012,7 @@ apply:
         }
     }
 
-    return fa_vcap_entry_cmd(vtss_state, data, addr, data->tg, FA_VCAP_CMD_WRITE, FA_VCAP_SEL_ALL);
+    return fa_vcap_entry_set(vtss_state, data, addr);
 }
 
 static vtss_rc fa_is2_entry_get(vtss_state_t *vtss_state, vtss_vcap_type_t type, vtss_vcap_idx_t *idx, u32 *counter, BOOL clear)
@@ -3503,7 +3556,7 @@ static vtss_rc fa_es2_entry_add(vtss_state_t *vtss_state, vtss_vcap_idx_t *idx,
     FA_ACT_SET(ES2, BASE_TYPE_CNT_ID, is2->cnt_id);
     VTSS_RC(fa_es2_cnt_set(vtss_state, is2->cnt_id, counter));
 
-    return fa_vcap_entry_cmd(vtss_state, data, addr, data->tg, FA_VCAP_CMD_WRITE, FA_VCAP_SEL_ALL);
+    return fa_vcap_entry_set(vtss_state, data, addr);
 }
 
 static vtss_rc fa_es2_entry_del(vtss_state_t *vtss_state, vtss_vcap_idx_t *idx)
@@ -4635,7 +4688,7 @@ static vtss_rc fa_es0_entry_add(vtss_state_t *vtss_state, vtss_vcap_idx_t *idx,
     /* Update action fields based on egress QoS mapping */
     VTSS_RC(fa_es0_action_update(vtss_state, data, es0));
 
-    return fa_vcap_entry_cmd(vtss_state, data, addr, data->tg, FA_VCAP_CMD_WRITE, FA_VCAP_SEL_ALL);
+    return fa_vcap_entry_set(vtss_state, data, addr);
 }
 
 static vtss_rc fa_es0_entry_del(vtss_state_t *vtss_state, vtss_vcap_idx_t *idx)
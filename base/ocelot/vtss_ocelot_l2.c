@@ -544,28 +544,68 @@ static vtss_rc srvl_vlan_table_idle(vtss_state_t *vtss_state)
     return VTSS_RC_OK;
 }
 
+#if defined(VTSS_FEATURE_WARM_START)
+#define SRVL_VLANTIDX_MASK (VTSS_M_ANA_ANA_TABLES_VLANTIDX_V_INDEX | \
+                            VTSS_F_ANA_ANA_TABLES_VLANTIDX_VLAN_PRIV_VLAN | \
+                            VTSS_F_ANA_ANA_TABLES_VLANTIDX_VLAN_LEARN_DISABLED | \
+                            VTSS_F_ANA_ANA_TABLES_VLANTIDX_VLAN_MIRROR | \
+                            VTSS_F_ANA_ANA_TABLES_VLANTIDX_VLAN_SRC_CHK)
+#endif /* VTSS_FEATURE_WARM_START */
+
 static vtss_rc srvl_vlan_mask_update(vtss_state_t *vtss_state,
                                      vtss_vid_t vid, BOOL member[VTSS_PORT_ARRAY_SIZE])
 {
     vtss_vlan_entry_t *e = &vtss_state->l2.vlan_table[vid];
+    u32               tidx, mask;
+#if defined(VTSS_FEATURE_VLAN_SVL)
+    u32               fid;
+#endif /* VTSS_FEATURE_VLAN_SVL */
 
-    /* Index and properties */
-    SRVL_WR(VTSS_ANA_ANA_TABLES_VLANTIDX, 
-            VTSS_F_ANA_ANA_TABLES_VLANTIDX_V_INDEX(vid) |
+    tidx = (VTSS_F_ANA_ANA_TABLES_VLANTIDX_V_INDEX(vid) |
             (e->flags & VLAN_FLAGS_ISOLATED ? VTSS_F_ANA_ANA_TABLES_VLANTIDX_VLAN_PRIV_VLAN : 0) |
             (e->flags & VLAN_FLAGS_LEARN ? 0 : VTSS_F_ANA_ANA_TABLES_VLANTIDX_VLAN_LEARN_DISABLED) |
             (e->flags & VLAN_FLAGS_MIRROR ? VTSS_F_ANA_ANA_TABLES_VLANTIDX_VLAN_MIRROR : 0) |
             (e->flags & VLAN_FLAGS_FILTER ? VTSS_F_ANA_ANA_TABLES_VLANTIDX_VLAN_SRC_CHK : 0));
+    mask = vtss_srvl_port_mask(vtss_state, member);
+#if defined(VTSS_FEATURE_VLAN_SVL)
+    fid = VTSS_F_ANA_FID_MAP_FID_MAP_FID_C_VAL(e->fid > SRVL_FID_MAX ? 0 : e->fid);
+#endif /* VTSS_FEATURE_VLAN_SVL */
+
+#if defined(VTSS_FEATURE_WARM_START)
+    if (vtss_state->sync_active) {
+        /* Warm start synchronization: Skip entry if unchanged */
+        u32  value;
+        BOOL changed;
+
+        SRVL_WR(VTSS_ANA_ANA_TABLES_VLANTIDX, VTSS_F_ANA_ANA_TABLES_VLANTIDX_V_INDEX(vid));
+        SRVL_WR(VTSS_ANA_ANA_TABLES_VLANACCESS,
+                VTSS_F_ANA_ANA_TABLES_VLANACCESS_VLAN_TBL_CMD(VLAN_CMD_READ));
+        VTSS_RC(srvl_vlan_table_idle(vtss_state));
+        SRVL_RD(VTSS_ANA_ANA_TABLES_VLANACCESS, &value);
+        changed = (VTSS_X_ANA_ANA_TABLES_VLANACCESS_VLAN_PORT_MASK(value) != mask);
+        SRVL_RD(VTSS_ANA_ANA_TABLES_VLANTIDX, &value);
+        changed = (changed || (value & SRVL_VLANTIDX_MASK) != tidx);
+#if defined(VTSS_FEATURE_VLAN_SVL)
+        SRVL_RD(VTSS_ANA_FID_MAP_FID_MAP(vid), &value);
+        changed = (changed || (value & VTSS_M_ANA_FID_MAP_FID_MAP_FID_C_VAL) != fid);
+#endif /* VTSS_FEATURE_VLAN_SVL */
+        if (!vtss_cmn_sync_changed(vtss_state, changed)) {
+            return VTSS_RC_OK;
+        }
+    }
+#endif /* VTSS_FEATURE_WARM_START */
+
+    /* Index and properties */
+    SRVL_WR(VTSS_ANA_ANA_TABLES_VLANTIDX, tidx);
 
     /* VLAN mask */
     SRVL_WR(VTSS_ANA_ANA_TABLES_VLANACCESS,
-            VTSS_F_ANA_ANA_TABLES_VLANACCESS_VLAN_PORT_MASK(vtss_srvl_port_mask(vtss_state, member)) |
+            VTSS_F_ANA_ANA_TABLES_VLANACCESS_VLAN_PORT_MASK(mask) |
             VTSS_F_ANA_ANA_TABLES_VLANACCESS_VLAN_TBL_CMD(VLAN_CMD_WRITE));
 
 #if defined(VTSS_FEATURE_VLAN_SVL)
     /* FID */
-    SRVL_WR(VTSS_ANA_FID_MAP_FID_MAP(vid),
-            VTSS_F_ANA_FID_MAP_FID_MAP_FID_C_VAL(e->fid > SRVL_FID_MAX ? 0 : e->fid));
+    SRVL_WR(VTSS_ANA_FID_MAP_FID_MAP(vid), fid);
 #endif /* VTSS_FEATURE_VLAN_SVL */
 
     return srvl_vlan_table_idle(vtss_state);
@@ -649,12 +649,56 @@ static vtss_rc srvl_vcap_entry_data_get(vtss_state_t *vtss_state,
     return VTSS_RC_OK;
 }
 
+#if defined(VTSS_FEATURE_WARM_START)
+/* Warm start synchronization: Check if row differs from the chip, ignoring counters */
+static vtss_rc srvl_vcap_entry_changed(vtss_state_t *vtss_state,
+                                       const tcam_props_t *tcam, vtss_vcap_idx_t *idx,
+                                       srvl_tcam_data_t *data, BOOL *changed)
+{
+    srvl_tcam_data_t cur;
+    u32              i, width, mask = 0;
+
+    VTSS_RC(srvl_vcap_entry_get(vtss_state, tcam, idx, &cur));
+    *changed = (cur.tg != data->tg);
+    for (i = 0; i < tcam->entry_words && !*changed; i++) {
+        *changed = (cur.entry[i] != data->entry[i] || cur.mask[i] != data->mask[i]);
+    }
+    width = tcam->action_type_width;
+    if (width) {
+        /* Action type is encoded when writing the action cache */
+        mask = VTSS_BITMASK(width);
+        if ((cur.action[0] & mask) != data->type) {
+            *changed = TRUE;
+        }
+    }
+    for (i = 0; i < tcam->action_words && !*changed; i++) {
+        *changed = ((i == 0 ? (cur.action[i] & ~mask) != (data->action[i] & ~mask) :
+                     cur.action[i] != data->action[i]));
+    }
+    return VTSS_RC_OK;
+}
+#endif /* VTSS_FEATURE_WARM_START */
+
 static vtss_rc srvl_vcap_entry_set(vtss_state_t *vtss_state,
                                    const tcam_props_t *tcam, vtss_vcap_idx_t *idx, 
                                    srvl_tcam_data_t *data)
 {
+#if defined(VTSS_FEATURE_WARM_START)
+    BOOL changed;
+#endif /* VTSS_FEATURE_WARM_START */
+
     VTSS_I("%s, row: %u", tcam->name, idx->row);
 
+#if defined(VTSS_FEATURE_WARM_START)
+    if (vtss_state->sync_active) {
+        /* Skip unchanged row, keeping the counters */
+        VTSS_RC(srvl_vcap_entry_changed(vtss_state, tcam, idx, data, &changed));
+        if (!vtss_cmn_sync_changed(vtss_state, changed)) {
+            return VTSS_RC_OK;
+        }
+    }
+#endif /* VTSS_FEATURE_WARM_START */
+
     /* Write row */
     VTSS_RC(srvl_vcap_entry2cache(vtss_state, tcam, data));
     VTSS_RC(srvl_vcap_action2cache(vtss_state, tcam, data));
@@ -630,6 +630,8 @@ typedef struct {
     vtss_restart_t restart;      /**< Previous restart mode */
     vtss_version_t prev_version; /**< Previous API version */
     vtss_version_t cur_version;  /**< Current API version */
+    u32            sync_entries; /**< Table entries read back and checked by warm start synchronization */
+    u32            sync_changed; /**< Table entries written by warm start synchronization */
 } vtss_restart_status_t;
 
 /**
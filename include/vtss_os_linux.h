@@ -360,6 +360,23 @@ static inline int __builtin_ctzl(unsigned long val32)
 #define VTSS_OS_FREE(ptr, flags) free(ptr)
 #endif
 
+/**
+ * VTSS_OS_TIME_USEC()
+ * VTSS_OS_CPU_USEC()
+ *   Monotonic time and CPU time of the calling thread in microseconds (u64).
+ *   Used for profiling the initialization phases, see VTSS_DEBUG_GROUP_INIT.
+ *   If undefined, the profiling is not included.
+ */
+#ifndef __KERNEL__
+#define VTSS_OS_CLOCK_USEC(clk) ({                                   \
+    struct timespec _ts;                                             \
+    (void)clock_gettime(clk, &_ts);                                  \
+    (u64)_ts.tv_sec * 1000000 + (u64)_ts.tv_nsec / 1000;             \
+})
+#define VTSS_OS_TIME_USEC() VTSS_OS_CLOCK_USEC(CLOCK_MONOTONIC)
+#define VTSS_OS_CPU_USEC()  VTSS_OS_CLOCK_USEC(CLOCK_THREAD_CPUTIME_ID)
+#endif
+
 /**
  * Wrap of call to rand() defined in stdlib.h
  */
@@ -331,7 +331,23 @@ vtss_rc vtss_port_conf_set(const vtss_inst_t       inst,
                            const vtss_port_no_t    port_no,
                            const vtss_port_conf_t  *const conf);
 
-
+/**
+ * \brief Set port configuration for a list of ports.
+ * The ports are configured as by vtss_port_conf_set(), but the phases of the port
+ * bring-up that involve waiting (the port flush drain time and the SerDes setup stages)
+ * are issued for all ports before waiting once per phase, instead of once per port.
+ *
+ * \param inst [IN]       Target instance reference.
+ * \param cnt [IN]        Number of entries in port_list and conf_list.
+ * \param port_list [IN]  Port numbers.
+ * \param conf_list [IN]  Port setup structures, one per entry in port_list.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_port_conf_list_set(const vtss_inst_t       inst,
+                                const u32               cnt,
+                                const vtss_port_no_t    *const port_list,
+                                const vtss_port_conf_t  *const conf_list);
 
 /**
  * \brief Get port setup.
@@ -569,6 +585,111 @@ vtss_rc vtss_miim_write(const vtss_inst_t            inst,
                         const u8                     miim_addr,
                         const u8                     addr,
                         const u16                    value);
+
+/** \brief MIIM register access, used for access lists */
+typedef struct {
+    vtss_miim_controller_t miim_controller; /**< MIIM Controller Instance */
+    u8                     miim_addr;       /**< MIIM Device Address */
+    u8                     addr;            /**< MIIM Register Address */
+    BOOL                   write;           /**< Write access if TRUE, read access otherwise */
+    u16                    value;           /**< Register value to write or register value read */
+    vtss_rc                rc;              /**< Return code of the access */
+} vtss_miim_access_t;
+
+/**
+ * \brief Direct MIIM access list (bypassing port map)
+ *
+ * Consecutive accesses are done while holding the API lock once. As for
+ * vtss_miim_read()/vtss_miim_write(), an access with bit 7 set in miim_addr
+ * is done without taking the API lock.
+ * Accesses on the same MIIM controller are done in list order, while
+ * accesses on different MIIM controllers may be done concurrently.
+ *
+ * \param inst    [IN]     Target instance reference.
+ * \param chip_no [IN]     Chip number (if multi-chip instance).
+ * \param cnt     [IN]     Number of entries in list.
+ * \param list    [IN/OUT] List of accesses. The value and rc fields are updated.
+ *
+ * \return Return code, VTSS_RC_ERROR if any of the accesses failed.
+ **/
+vtss_rc vtss_miim_access_list(const vtss_inst_t        inst,
+                              const vtss_chip_no_t     chip_no,
+                              const u32                cnt,
+                              vtss_miim_access_t *const list);
+
+/** \brief MIIM scan configuration */
+typedef struct {
+    BOOL enable;         /**< Enable automatic scanning of a PHY register */
+    u8   miim_addr_low;  /**< Lowest MIIM Device Address scanned */
+    u8   miim_addr_high; /**< Highest MIIM Device Address scanned */
+    u8   addr;           /**< MIIM Register Address scanned (Clause 22) */
+    u16  mask;           /**< Mask used when comparing the register value with the expected value */
+    u16  expect;         /**< Expected register value */
+} vtss_miim_scan_conf_t;
+
+/**
+ * \brief Get MIIM scan configuration
+ *
+ * \param inst            [IN]  Target instance reference.
+ * \param chip_no         [IN]  Chip number (if multi-chip instance).
+ * \param miim_controller [IN]  MIIM Controller Instance
+ * \param conf            [OUT] Scan configuration.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_miim_scan_conf_get(const vtss_inst_t            inst,
+                                const vtss_chip_no_t         chip_no,
+                                const vtss_miim_controller_t miim_controller,
+                                vtss_miim_scan_conf_t        *const conf);
+
+/**
+ * \brief Set MIIM scan configuration.
+ * While scanning is enabled, the MIIM controller continuously reads the register from
+ * the PHYs in the address range and compares it with the expected value.
+ * Direct MIIM accesses on the controller suspend the scanning while in progress.
+ * Scanning also stays suspended while a Clause 22 write to register 31 has left a PHY
+ * in the address range on a non-standard page, so the register is always read from the
+ * standard page. Page 0 (register 31 value zero) is assumed to be the standard page, as
+ * for the Microchip PHYs. The PHYs are not scanned while suspended and their valid bits
+ * are cleared.
+ * Note that scanning reads the register continuously. If the register has latching bits,
+ * like the latched-low link status in register 1, the scan reads clear them. A PHY driver
+ * reading the register can then no longer see a short link drop, which is only reported
+ * by the mismatch bit of vtss_miim_scan_status_get().
+ *
+ * \param inst            [IN]  Target instance reference.
+ * \param chip_no         [IN]  Chip number (if multi-chip instance).
+ * \param miim_controller [IN]  MIIM Controller Instance
+ * \param conf            [IN]  Scan configuration.
+ *
+ * \return Return code, VTSS_RC_ERROR if scanning is not supported.
+ **/
+vtss_rc vtss_miim_scan_conf_set(const vtss_inst_t            inst,
+                                const vtss_chip_no_t         chip_no,
+                                const vtss_miim_controller_t miim_controller,
+                                const vtss_miim_scan_conf_t  *const conf);
+
+/** \brief MIIM scan status. Bit N is used for MIIM Device Address N */
+typedef struct {
+    u32 valid;    /**< Scan result is valid */
+    u32 match;    /**< Last register value read matched the expected value */
+    u32 mismatch; /**< Register value has mismatched the expected value since last status get */
+} vtss_miim_scan_status_t;
+
+/**
+ * \brief Get MIIM scan status
+ *
+ * \param inst            [IN]  Target instance reference.
+ * \param chip_no         [IN]  Chip number (if multi-chip instance).
+ * \param miim_controller [IN]  MIIM Controller Instance
+ * \param status          [OUT] Scan status.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_miim_scan_status_get(const vtss_inst_t            inst,
+                                  const vtss_chip_no_t         chip_no,
+                                  const vtss_miim_controller_t miim_controller,
+                                  vtss_miim_scan_status_t      *const status);
 #endif /* VTSS_FEATURE_PORT_CONTROL */
 
 /**
@@ -966,6 +1087,23 @@ vtss_rc vtss_port_kr_irq_get(vtss_inst_t inst,
                              const vtss_port_no_t port_no,
                              u32 *const irq_vec);
 
+/**
+ * \brief Get and clear KR interrupts for a list of ports
+ * The interrupts of all ports are gathered in one pass, so the training of
+ * several ports can be progressed from a single poll.
+ *
+ * \param inst      [IN]  Target instance reference.
+ * \param cnt       [IN]  Number of entries in port_list and irq_list.
+ * \param port_list [IN]  Port numbers.
+ * \param irq_list  [OUT] 32 bit interrupt vector for each entry in port_list.
+ *
+ * \return Return code.
+ **/
+vtss_rc vtss_port_kr_irq_list_get(vtss_inst_t inst,
+                                  const u32 cnt,
+                                  const vtss_port_no_t *const port_list,
+                                  u32 *const irq_list);
+
 
 /**
  * \brief Get KR IRQ activity
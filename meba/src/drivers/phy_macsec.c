@@ -395,6 +395,17 @@ mepa_rc meba_phy_macsec_tx_sa_activate(meba_inst_t inst, mepa_port_no_t port_no,
     return mepa_macsec_tx_sa_activate(inst->phy_devices[port_no], port, an);
 }
 
+mepa_rc meba_phy_macsec_sa_rollover(meba_inst_t inst, mepa_port_no_t port_no, const mepa_macsec_port_t port, const uint16_t an, const uint32_t next_pn, const uint32_t lowest_pn, const mepa_bool_t confidentiality, const mepa_macsec_sak_t *const sak, const mepa_bool_t activate)
+{
+    mesa_rc rc = MESA_RC_ERROR;
+
+    if ((rc = meba_dev_chk(inst, port_no)) != MESA_RC_OK) {
+        return rc;
+    }
+
+    return mepa_macsec_sa_rollover(inst->phy_devices[port_no], port, an, next_pn, lowest_pn, confidentiality, sak, activate);
+}
+
 mepa_rc meba_phy_macsec_tx_sa_disable(meba_inst_t inst, mepa_port_no_t port_no, const mepa_macsec_port_t port, const uint16_t an)
 {
     mesa_rc rc = MESA_RC_ERROR;
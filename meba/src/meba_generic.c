@@ -261,6 +261,51 @@ mepa_rc meba_miim_write(struct mepa_callout_ctx         *ctx,
                            ctx->miim_addr, addr, value);
 }
 
+// MIIM access list, done using the MESA access list so that targets supporting it
+// (e.g. SparX-5) can post the accesses without a lock round trip per access.
+// MMD accesses are not covered by the MESA access list and are done one at a time.
+mepa_rc meba_miim_access_list(struct mepa_callout_ctx         *ctx,
+                              const uint32_t                   cnt,
+                              mepa_miim_access_t              *const list)
+{
+    mesa_miim_access_t access[8];
+    mepa_miim_access_t *entry;
+    uint32_t           i, j, n;
+    mepa_rc            rc;
+
+    for (i = 0; i < cnt; i += n) {
+        entry = &list[i];
+        if (entry->mmd) {
+            n = 1;
+            if (entry->write) {
+                rc = meba_mmd_write(ctx, entry->mmd, entry->addr, entry->value);
+            } else {
+                rc = meba_mmd_read(ctx, entry->mmd, entry->addr, &entry->value);
+            }
+            if (rc != MESA_RC_OK) {
+                return rc;
+            }
+            continue;
+        }
+        // Run of up to 8 clause 22 accesses
+        for (n = 0; n < 8 && (i + n) < cnt && list[i + n].mmd == 0; n++) {
+            access[n].miim_controller = ctx->miim_controller;
+            access[n].miim_addr = ctx->miim_addr;
+            access[n].addr = list[i + n].addr;
+            access[n].write = list[i + n].write;
+            access[n].value = list[i + n].value;
+            access[n].rc = MESA_RC_OK;
+        }
+        if (mesa_miim_access_list(ctx->inst, ctx->chip_no, n, access) != MESA_RC_OK) {
+            return MESA_RC_ERROR;
+        }
+        for (j = 0; j < n; j++) {
+            list[i + j].value = access[j].value;
+        }
+    }
+    return MESA_RC_OK;
+}
+
 static void *mem_alloc(struct mepa_callout_ctx *ctx, size_t size)
 {
     return malloc(size);
@@ -297,6 +342,7 @@ void meba_phy_driver_init(meba_inst_t inst)
     inst->mepa_callout.mmd_write = meba_mmd_write;
     inst->mepa_callout.miim_read = meba_miim_read;
     inst->mepa_callout.miim_write = meba_miim_write;
+    inst->mepa_callout.miim_access_list = meba_miim_access_list;
     inst->mepa_callout.lock_enter = inst->iface.lock_enter;
     inst->mepa_callout.lock_exit = inst->iface.lock_exit;
     inst->mepa_callout.mem_alloc = mem_alloc;
@@ -1046,7 +1046,25 @@ static mesa_rc fa_sfp_i2c_xfer(meba_inst_t inst,
         uint8_t i2c_data[3];
         i2c_data[0] = addr;
         memcpy(&i2c_data[1], data, 2);
+        if (i2c_addr == 0x50 && port_no < board->port_cnt) {
+            board->port[port_no].sfp_rom_valid = false;
+        }
         rc = inst->iface.i2c_write(board_port, i2c_addr, i2c_data, 3);
+    } else if (i2c_addr == 0x50 && port_no < board->port_cnt &&
+               board->port[port_no].sfp_present && addr + cnt <= SFP_ROM_SIZE) {
+        // The ID fields of the A0h page are read from the cache, which
+        // is only valid while the module is present.
+        fa_port_info_t *port = &board->port[port_no];
+        rc = MESA_RC_OK;
+        if (!port->sfp_rom_valid) {
+            rc = inst->iface.i2c_read(board_port, i2c_addr, 0, port->sfp_rom, SFP_ROM_SIZE);
+            // rom[0] == 0x03 means SFP or SFP+. Slow modules may not be
+            // ready yet, so nothing else is cached.
+            port->sfp_rom_valid = (rc == MESA_RC_OK && port->sfp_rom[0] == 0x03);
+        }
+        if (rc == MESA_RC_OK) {
+            memcpy(data, &port->sfp_rom[addr], cnt);
+        }
     } else {
         rc = inst->iface.i2c_read(board_port, i2c_addr, addr, data, cnt);
     }
@@ -1055,6 +1073,17 @@ static mesa_rc fa_sfp_i2c_xfer(meba_inst_t inst,
     return rc;
 }
 
+static void fa_sfp_present_set(meba_board_state_t *board, mesa_port_no_t port_no, mesa_bool_t present)
+{
+    fa_port_info_t *port = &board->port[port_no];
+
+    if (port->sfp_present != present) {
+        // Module inserted or removed, the cached ROM is stale
+        port->sfp_present = present;
+        port->sfp_rom_valid = false;
+    }
+}
+
 static mesa_rc fa_sfp_insertion_status_get(meba_inst_t inst, mesa_port_list_t *present)
 {
     mesa_rc                rc = MESA_RC_OK;
@@ -1071,6 +1100,7 @@ static mesa_rc fa_sfp_insertion_status_get(meba_inst_t inst, mesa_port_list_t *p
             if (is_sfp_port(board->port[port_no].map.cap)) {
                 mesa_bool_t detect = get_sfp_status(inst, port_no, data, SFP_DETECT);
                 mesa_port_list_set(present, port_no, detect);
+                fa_sfp_present_set(board, port_no, detect);
                 T_N(inst, "port:%d, status:%d", port_no, detect);
             }
         }
@@ -1099,6 +1129,7 @@ static mesa_rc fa_sfp_status_get(meba_inst_t inst,
                     status->tx_fault = get_sfp_status(inst, port_no, data, SFP_FAULT);
                     status->los      = get_sfp_status(inst, port_no, data, SFP_LOS);
                 }
+                fa_sfp_present_set(board, port_no, status->present);
                 T_N(inst, "port(%d): rc %d, present:%d los:%d tx_fault:%d", port_no, rc,
                     status->present, status->los, status->tx_fault);
             }
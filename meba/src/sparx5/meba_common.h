@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #define MAX_PORTS 57
+#define SFP_ROM_SIZE 128 // Cached part of the SFP A0h page (base and extended ID fields)
 typedef struct {
     meba_port_entry_t  map;
     uint32_t           board_port;
@@ -10,6 +11,9 @@ typedef struct {
     mesa_port_status_t status;
     mesa_bool_t        activity;
     mesa_bool_t        ts_phy;
+    mesa_bool_t        sfp_present;           // SFP module detected by the last status poll
+    mesa_bool_t        sfp_rom_valid;         // sfp_rom holds the ROM of the present module
+    uint8_t            sfp_rom[SFP_ROM_SIZE];
 } fa_port_info_t;
 
 // The PCB type
@@ -763,6 +763,12 @@ void mepa_mem_free_int(const mepa_callout_t    MEPA_SHARED_PTR *callout,
                        struct mepa_callout_ctx MEPA_SHARED_PTR *callout_ctx,
                        void                                    *ptr);
 
+/** \brief MII management access list. Falls back to single accesses if the miim_access_list callout is not provided */
+mepa_rc mepa_miim_access_list_int(const mepa_callout_t    MEPA_SHARED_PTR *callout,
+                                  struct mepa_callout_ctx MEPA_SHARED_PTR *callout_ctx,
+                                  const uint32_t                           cnt,
+                                  mepa_miim_access_t                      *const list);
+
 /** \brief Internal function for drivers to use to build mepa_inst structure */
 struct mepa_device *mepa_create_int(
         mepa_driver_t                           *drv,
@@ -40,6 +40,7 @@ typedef mepa_rc (*mepa_macsec_rx_seca_lowest_pn_update_t)(struct mepa_device *de
 typedef mepa_rc (*mepa_macsec_tx_sa_set_t)(struct mepa_device *dev, const mepa_macsec_port_t port, const uint16_t an, const uint32_t next_pn, const mepa_bool_t confidentiality, const mepa_macsec_sak_t *const sak);
 typedef mepa_rc (*mepa_macsec_tx_sa_get_t)(struct mepa_device *dev, const mepa_macsec_port_t port, const uint16_t an, uint32_t *const next_pn, mepa_bool_t *const confidentiality, mepa_macsec_sak_t *const sak, mepa_bool_t *const active);
 typedef mepa_rc (*mepa_macsec_tx_sa_activate_t)(struct mepa_device *dev, const mepa_macsec_port_t port, const uint16_t an);
+typedef mepa_rc (*mepa_macsec_sa_rollover_t)(struct mepa_device *dev, const mepa_macsec_port_t port, const uint16_t an, const uint32_t next_pn, const uint32_t lowest_pn, const mepa_bool_t confidentiality, const mepa_macsec_sak_t *const sak, const mepa_bool_t activate);
 typedef mepa_rc (*mepa_macsec_tx_sa_disable_t)(struct mepa_device *dev, const mepa_macsec_port_t port, const uint16_t an);
 typedef mepa_rc (*mepa_macsec_tx_sa_del_t)(struct mepa_device *dev, const mepa_macsec_port_t port, const uint16_t an);
 typedef mepa_rc (*mepa_macsec_tx_sa_status_get_t)(struct mepa_device *dev, const mepa_macsec_port_t port, const uint16_t an, mepa_macsec_tx_sa_status_t *const status);
@@ -213,6 +214,7 @@ typedef struct mepa_macsec_driver {
     mepa_macsec_dbg_reconfig_t mepa_macsec_dbg_reconfig;
 #endif
     mepa_macsec_dbg_update_seq_set_t mepa_macsec_dbg_update_seq_set;
+    mepa_macsec_sa_rollover_t mepa_macsec_sa_rollover;
 
 
 } mepa_macsec_driver_t;
@@ -135,6 +135,48 @@ void mepa_mem_free_int(const mepa_callout_t    MEPA_SHARED_PTR *callout,
     callout->mem_free(callout_ctx, ptr);
 }
 
+mepa_rc mepa_miim_access_list_int(const mepa_callout_t    MEPA_SHARED_PTR *callout,
+                                  struct mepa_callout_ctx MEPA_SHARED_PTR *callout_ctx,
+                                  const uint32_t                           cnt,
+                                  mepa_miim_access_t                      *const list)
+{
+    uint32_t           i;
+    mepa_miim_access_t *access;
+    mepa_rc            rc;
+
+    if (callout->miim_access_list) {
+        return callout->miim_access_list(callout_ctx, cnt, list);
+    }
+
+    // Fall back to single accesses
+    for (i = 0; i < cnt; i++) {
+        access = &list[i];
+        if (access->mmd) {
+            if (!callout->mmd_read || !callout->mmd_write) {
+                return MEPA_RC_NOT_IMPLEMENTED;
+            }
+            if (access->write) {
+                rc = callout->mmd_write(callout_ctx, access->mmd, access->addr, access->value);
+            } else {
+                rc = callout->mmd_read(callout_ctx, access->mmd, access->addr, &access->value);
+            }
+        } else {
+            if (!callout->miim_read || !callout->miim_write) {
+                return MEPA_RC_NOT_IMPLEMENTED;
+            }
+            if (access->write) {
+                rc = callout->miim_write(callout_ctx, access->addr, access->value);
+            } else {
+                rc = callout->miim_read(callout_ctx, access->addr, &access->value);
+            }
+        }
+        if (rc != MEPA_RC_OK) {
+            return rc;
+        }
+    }
+    return MEPA_RC_OK;
+}
+
 struct mepa_device *mepa_create_int(
     mepa_driver_t *drv,
     const mepa_callout_t    MEPA_SHARED_PTR *callout,
@@ -1728,6 +1770,26 @@ mepa_rc mepa_macsec_tx_sa_activate(struct mepa_device *dev,
     return dev->drv->mepa_macsec->mepa_macsec_tx_sa_activate(dev, port, an);
 }
 
+mepa_rc mepa_macsec_sa_rollover(struct mepa_device *dev,
+                                const mepa_macsec_port_t port,
+                                const uint16_t an,
+                                const uint32_t next_pn,
+                                const uint32_t lowest_pn,
+                                const mepa_bool_t confidentiality,
+                                const mepa_macsec_sak_t *const sak,
+                                const mepa_bool_t activate)
+{
+    if (!dev->drv->mepa_macsec) {
+        return MESA_RC_NOT_IMPLEMENTED;
+    }
+
+    if (!dev->drv->mepa_macsec->mepa_macsec_sa_rollover) {
+        return MESA_RC_NOT_IMPLEMENTED;
+    }
+
+    return dev->drv->mepa_macsec->mepa_macsec_sa_rollover(dev, port, an, next_pn, lowest_pn, confidentiality, sak, activate);
+}
+
 mepa_rc mepa_macsec_tx_sa_disable(struct mepa_device *dev,
                                   const mepa_macsec_port_t port,
                                   const uint16_t an)
@@ -99,6 +99,33 @@ typedef mepa_rc (*mepa_miim_write_t)(struct mepa_callout_ctx         *ctx,
                                      const uint8_t                    addr,
                                      const uint16_t                   value);
 
+/** \brief MII management register access, used for access lists */
+typedef struct {
+    uint8_t     mmd;   /**< MMD for an MMD access (IEEE 802.3 clause 45), zero for a clause 22 access */
+    uint16_t    addr;  /**< Register address (0-31 for a clause 22 access) */
+    mepa_bool_t write; /**< Write access if TRUE, read access otherwise */
+    uint16_t    value; /**< Register value to write or register value read */
+} mepa_miim_access_t;
+
+/**
+ * \brief MII management access list function (IEEE 802.3 clause 22 and clause 45 MMD).
+ * The accesses are done in list order. This callout is optional, if it is not
+ * provided the accesses are done using miim_read/miim_write and mmd_read/mmd_write.
+ * MMD accesses are single register accesses like mmd_read/mmd_write, incrementing
+ * reads (mmd_read_inc) are not covered.
+ *
+ * \param ctx   [IN]     Pointer to a callout structure.
+ * \param cnt   [IN]     Number of entries in list.
+ * \param list  [IN/OUT] List of accesses. The value is updated for read accesses.
+ *
+ * \return
+ *   MEPA_RC_NOT_IMPLEMENTED when not supported.\n
+ *   MEPA_RC_OK on success. On failure, the values read after the failing access are undefined.
+ **/
+typedef mepa_rc (*mepa_miim_access_list_t)(struct mepa_callout_ctx *ctx,
+                                           const uint32_t           cnt,
+                                           mepa_miim_access_t      *const list);
+
 
 /**
  * \brief SPI  read function
@@ -206,6 +233,8 @@ typedef struct mepa_callout {
 
     mepa_mem_alloc_t       mem_alloc;
     mepa_mem_free_t        mem_free;
+
+    mepa_miim_access_list_t miim_access_list; /**< Optional, see mepa_miim_access_list_t */
 } mepa_callout_t;
 
 struct vtss_state_s;
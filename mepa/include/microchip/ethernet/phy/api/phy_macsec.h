@@ -534,6 +534,20 @@ mepa_rc mepa_macsec_tx_sa_activate(struct mepa_device *dev,
                                    const uint16_t an);
 
 
+/** Install a new SAK on every Rx SC of the SecY and on the Tx SC in one call.
+    The Rx SAs are enabled right away; the Tx SA only when activate is set.
+    Not supported for XPN cipher suites.
+ */
+mepa_rc mepa_macsec_sa_rollover(struct mepa_device *dev,
+                                const mepa_macsec_port_t port,
+                                const uint16_t an,
+                                const uint32_t next_pn,
+                                const uint32_t lowest_pn,
+                                const mepa_bool_t confidentiality,
+                                const mepa_macsec_sak_t *const sak,
+                                const mepa_bool_t activate);
+
+
 /** This function disables Tx SA identified by an. Frames still in the pipeline are not discarded. */
 mepa_rc mepa_macsec_tx_sa_disable(struct mepa_device *dev,
                                   const mepa_macsec_port_t port,
@@ -117,13 +117,18 @@ static int (mdiobus_write)(void *mdiobus_data, uint16_t addr, uint32_t regnum, u
 
 static bool intl_mode_is_usxgmii(mepa_device_t *dev)
 {
-    uint16_t reg_val = 0;
-
-    dev->callout->mmd_write(dev->callout_ctx, 0x1e, 0x0006, 0x8800);
-    dev->callout->mmd_write(dev->callout_ctx, 0x1e, 0x0007, 0x00d2);
-    dev->callout->mmd_read(dev->callout_ctx, 0x1e, 0x0005, &reg_val);
+    // Indirect read of the interface mode, submitted as one access list
+    mepa_miim_access_t list[] = {
+        { .mmd = 0x1e, .addr = 0x0006, .write = true, .value = 0x8800 },
+        { .mmd = 0x1e, .addr = 0x0007, .write = true, .value = 0x00d2 },
+        { .mmd = 0x1e, .addr = 0x0005, .write = false },
+    };
+
+    if (mepa_miim_access_list_int(dev->callout, dev->callout_ctx, 3, list) != MEPA_RC_OK) {
+        return false;
+    }
 
-    return reg_val == 2 ? true : false;
+    return list[2].value == 2 ? true : false;
 }
 
 static mesa_rc intl_if_get(mepa_device_t *dev, mesa_port_speed_t speed,
@@ -28,15 +28,13 @@ mepa_rc indy_direct_reg_rd(mepa_device_t *dev, uint16_t addr, uint16_t *value)
 mepa_rc indy_direct_reg_wr(mepa_device_t *dev, uint16_t addr, uint16_t value, uint16_t mask)
 {
     uint16_t reg_val = value;
-    mesa_rc rc;
+    mesa_rc rc = MESA_RC_OK;
 
-    rc = dev->callout->miim_read(dev->callout_ctx, addr, &reg_val);
+    if (mask != INDY_DEF_MASK) {
+        rc = dev->callout->miim_read(dev->callout_ctx, addr, &reg_val);
+        reg_val = (reg_val & ~mask) | (value & mask);
+    }
     if (rc == MESA_RC_OK) {
-        if (mask != INDY_DEF_MASK) {
-            reg_val = (reg_val & ~mask) | (value & mask);
-        } else {
-            reg_val = value;
-        }
         rc = dev->callout->miim_write(dev->callout_ctx, addr, reg_val);
         if (rc != MESA_RC_OK) {
             T_E(MEPA_TRACE_GRP_GEN, "Port %d miim write failed\n", dev->numeric_handle);
@@ -47,75 +45,83 @@ mepa_rc indy_direct_reg_wr(mepa_device_t *dev, uint16_t addr, uint16_t value, ui
     return MEPA_RC_OK;
 }
 
+// Add an access to a MIIM access list
+static void indy_access_add(mepa_miim_access_t *list, uint32_t *cnt, mepa_bool_t write, uint16_t addr, uint16_t value)
+{
+    list[*cnt].mmd = 0;
+    list[*cnt].addr = addr;
+    list[*cnt].write = write;
+    list[*cnt].value = value;
+    (*cnt)++;
+}
+
+// Indirect register access (extended page or MMD) using the access control and address/data register pair.
+// The set-up and the data access are submitted as one MIIM access list, read-modify-write needs a second list.
+static mepa_rc indy_indirect_reg_rd_wr(mepa_device_t *dev, uint16_t ctrl_reg, uint16_t data_reg, uint16_t sel, uint16_t func,
+                                       uint16_t addr, mepa_bool_t setup, mepa_bool_t read, uint16_t *value, uint16_t mask)
+{
+    mepa_miim_access_t list[4];
+    uint32_t           cnt = 0;
+    uint16_t           val = *value;
+
+    if (setup) {
+        indy_access_add(list, &cnt, TRUE, ctrl_reg, sel);
+        indy_access_add(list, &cnt, TRUE, data_reg, addr);
+        indy_access_add(list, &cnt, TRUE, ctrl_reg, func | sel);
+    }
+    if (read || mask != INDY_DEF_MASK) {
+        indy_access_add(list, &cnt, FALSE, data_reg, 0);
+        if (mepa_miim_access_list_int(dev->callout, dev->callout_ctx, cnt, list) != MEPA_RC_OK) {
+            T_E(MEPA_TRACE_GRP_GEN, "Port %d miim %s failed\n", dev->numeric_handle, read ? "read" : "write");
+            return MEPA_RC_OK;
+        }
+        if (read) {
+            *value = list[cnt - 1].value;
+            return MEPA_RC_OK;
+        }
+        val = (list[cnt - 1].value & ~mask) | (*value & mask);
+        cnt = 0;
+    }
+    indy_access_add(list, &cnt, TRUE, data_reg, val);
+    if (mepa_miim_access_list_int(dev->callout, dev->callout_ctx, cnt, list) != MEPA_RC_OK) {
+        T_E(MEPA_TRACE_GRP_GEN, "Port %d miim write failed\n", dev->numeric_handle);
+    }
+    return MEPA_RC_OK;
+}
+
 // Extended page read and write functions
 // Extended page numbers range : 0 - 31
 mepa_rc indy_ext_reg_rd(mepa_device_t *dev, uint16_t page, uint16_t addr, uint16_t *value)
 {
-    // Set-up to access extended page register.
-    MEPA_RC(indy_direct_reg_wr(dev, INDY_EXT_PAGE_ACCESS_CTRL, page, INDY_DEF_MASK));
-    MEPA_RC(indy_direct_reg_wr(dev, INDY_EXT_PAGE_ACCESS_ADDR_DATA, addr, INDY_DEF_MASK));
-    MEPA_RC(indy_direct_reg_wr(dev, INDY_EXT_PAGE_ACCESS_CTRL,
-                               INDY_F_EXT_PAGE_ACCESS_CTRL_EP_FUNC | page, INDY_DEF_MASK));
-
-    // Read the value
-    MEPA_RC(indy_direct_reg_rd(dev, INDY_EXT_PAGE_ACCESS_ADDR_DATA, value));
-    return MEPA_RC_OK;
+    return indy_indirect_reg_rd_wr(dev, INDY_EXT_PAGE_ACCESS_CTRL, INDY_EXT_PAGE_ACCESS_ADDR_DATA, page,
+                                   INDY_F_EXT_PAGE_ACCESS_CTRL_EP_FUNC, addr, TRUE, TRUE, value, INDY_DEF_MASK);
 }
 mepa_rc indy_ext_reg_wr(mepa_device_t *dev, uint16_t page, uint16_t addr, uint16_t value, uint16_t mask)
 {
-    // Set-up to access extended page register.
-    MEPA_RC(indy_direct_reg_wr(dev, INDY_EXT_PAGE_ACCESS_CTRL, page, INDY_DEF_MASK));
-    MEPA_RC(indy_direct_reg_wr(dev, INDY_EXT_PAGE_ACCESS_ADDR_DATA, addr, INDY_DEF_MASK));
-    MEPA_RC(indy_direct_reg_wr(dev, INDY_EXT_PAGE_ACCESS_CTRL,
-                               INDY_F_EXT_PAGE_ACCESS_CTRL_EP_FUNC | page, INDY_DEF_MASK));
-
-    // write the value
-    MEPA_RC(indy_direct_reg_wr(dev, INDY_EXT_PAGE_ACCESS_ADDR_DATA, value, mask));
-    return MEPA_RC_OK;
+    return indy_indirect_reg_rd_wr(dev, INDY_EXT_PAGE_ACCESS_CTRL, INDY_EXT_PAGE_ACCESS_ADDR_DATA, page,
+                                   INDY_F_EXT_PAGE_ACCESS_CTRL_EP_FUNC, addr, TRUE, FALSE, &value, mask);
 }
 
 // Extended page address incremental read. After reading one register address of would automatically be
 // incremented to next location in this function. This is useful for reading contiguous group of registers.
 mepa_rc indy_ext_incr_reg_rd(mepa_device_t *dev, uint16_t page, uint16_t addr, uint16_t *value, mepa_bool_t start_addr)
 {
-    if (start_addr) {
-        // Set-up to access extended page register.
-        MEPA_RC(indy_direct_reg_wr(dev, INDY_EXT_PAGE_ACCESS_CTRL, page, INDY_DEF_MASK));
-        MEPA_RC(indy_direct_reg_wr(dev, INDY_EXT_PAGE_ACCESS_ADDR_DATA, addr, INDY_DEF_MASK));
-        MEPA_RC(indy_direct_reg_wr(dev, INDY_EXT_PAGE_ACCESS_CTRL,
-                INDY_F_EXT_PAGE_ACCESS_CTRL_INCR_RD_WR | page, INDY_DEF_MASK));
-    }
-    // Read the value
-    MEPA_RC(indy_direct_reg_rd(dev, INDY_EXT_PAGE_ACCESS_ADDR_DATA, value));
-    return MEPA_RC_OK;
+    return indy_indirect_reg_rd_wr(dev, INDY_EXT_PAGE_ACCESS_CTRL, INDY_EXT_PAGE_ACCESS_ADDR_DATA, page,
+                                   INDY_F_EXT_PAGE_ACCESS_CTRL_INCR_RD_WR, addr, start_addr, TRUE, value, INDY_DEF_MASK);
 }
 
 // MMD read and write functions
 // MMD device range : 0 - 31
 mepa_rc indy_mmd_reg_rd(mepa_device_t *dev, uint16_t mmd, uint16_t addr, uint16_t *value)
 {
-    // Set-up to MMD register.
-    MEPA_RC(indy_direct_reg_wr(dev, INDY_MMD_ACCESS_CTRL, mmd, INDY_DEF_MASK));
-    MEPA_RC(indy_direct_reg_wr(dev, INDY_MMD_ACCESS_ADDR_DATA, addr, INDY_DEF_MASK));
-    MEPA_RC(indy_direct_reg_wr(dev, INDY_MMD_ACCESS_CTRL,
-                               INDY_F_MMD_ACCESS_CTRL_MMD_FUNC | mmd, INDY_DEF_MASK));
-
-    // Read the value
-    MEPA_RC(indy_direct_reg_rd(dev, INDY_MMD_ACCESS_ADDR_DATA, value));
-    return MEPA_RC_OK;
+    return indy_indirect_reg_rd_wr(dev, INDY_MMD_ACCESS_CTRL, INDY_MMD_ACCESS_ADDR_DATA, mmd,
+                                   INDY_F_MMD_ACCESS_CTRL_MMD_FUNC, addr, TRUE, TRUE, value, INDY_DEF_MASK);
 }
 
 mepa_rc indy_mmd_reg_wr(mepa_device_t *dev, uint16_t mmd, uint16_t addr, uint16_t value, uint16_t mask)
 {
-    // Set-up to MMD register.
-    MEPA_RC(indy_direct_reg_wr(dev, INDY_MMD_ACCESS_CTRL, mmd, INDY_DEF_MASK));
-    MEPA_RC(indy_direct_reg_wr(dev, INDY_MMD_ACCESS_ADDR_DATA, addr, INDY_DEF_MASK));
-    MEPA_RC(indy_direct_reg_wr(dev, INDY_MMD_ACCESS_CTRL,
-                               INDY_F_MMD_ACCESS_CTRL_MMD_FUNC | mmd, INDY_DEF_MASK));
-
-    // write the value
-    MEPA_RC(indy_direct_reg_wr(dev, INDY_MMD_ACCESS_ADDR_DATA, value, mask));
-    return MEPA_RC_OK;
+    return indy_indirect_reg_rd_wr(dev, INDY_MMD_ACCESS_CTRL, INDY_MMD_ACCESS_ADDR_DATA, mmd,
+                                   INDY_F_MMD_ACCESS_CTRL_MMD_FUNC, addr, TRUE, FALSE, &value, mask);
 }
 
 static mepa_rc indy_delete(mepa_device_t *dev)
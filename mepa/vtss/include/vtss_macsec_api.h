@@ -762,6 +762,30 @@ vtss_rc vtss_macsec_tx_sa_activate(const vtss_inst_t         inst,
                                    const u16                 an);
 
 
+/** \brief Install a new SAK for a SecY in one call: the Rx SA of every Rx SC and the Tx SA
+           are programmed (and the Rx SAs enabled) under a single API lock.
+ *
+ * \param inst            [IN]     VTSS-API instance.
+ * \param port            [IN]     MACsec port.
+ * \param an              [IN]     Association number, 0-3
+ * \param next_pn         [IN]     The packet number of the first packet sent using the new Tx SA (1 or greater)
+ * \param lowest_pn       [IN]     Lowest acceptable packet number on the new Rx SAs.
+ * \param confidentiality [IN]     If true, packets are encrypted, otherwise integrity protected only.
+ * \param sak             [IN]     The 128 or 256 bit Secure Association Key and the hash value.
+ * \param activate        [IN]     Also switch transmission to the new Tx SA.
+ *
+ * \return VTSS_RC_OK when successful; VTSS_RC_ERROR if parameters are invalid or the SecY uses an XPN cipher suite.
+ */
+vtss_rc vtss_macsec_sa_rollover(const vtss_inst_t         inst,
+                                const vtss_macsec_port_t  port,
+                                const u16                 an,
+                                const u32                 next_pn,
+                                const u32                 lowest_pn,
+                                const BOOL                confidentiality,
+                                const vtss_macsec_sak_t   *const sak,
+                                const BOOL                activate);
+
+
 /** \brief This function disables Tx SA identified by an. Frames still in the pipeline are not discarded.
 
  *
@@ -1509,6 +1509,31 @@ vtss_rc vtss_phy_do_page_chk_get(const vtss_inst_t    inst,
                                  BOOL *enable);
 
 
+/**
+ * \brief Debug function for enabling verification of the page register cache.
+ * When enabled, the page register is read back for the page check (see vtss_phy_do_page_chk_set) and compared with the cached page.
+ *
+ * \param inst [IN]     Target instance reference.
+ * \param enable [IN]   TRUE to enable page register cache verification. FALSE to disable
+ *
+ * \return Return code. VTSS_RC_OK if page register cache verification were set.
+ **/
+vtss_rc vtss_phy_page_cache_verify_set(const vtss_inst_t    inst,
+                                       const BOOL enable);
+
+
+/**
+ * \brief Debug function for getting if verification of the page register cache is enabled
+ *
+ * \param inst [IN]     Target instance reference.
+ * \param enable [OUT]   TRUE if page register cache verification is enabled else FALSE
+ *
+ * \return Return code. VTSS_RC_OK when enable is valid.
+ **/
+vtss_rc vtss_phy_page_cache_verify_get(const vtss_inst_t    inst,
+                                       BOOL *enable);
+
+
 /**
  * \brief Debug function for setting phy internal loopback
  *
@@ -457,6 +457,25 @@ typedef vtss_rc (*vtss_miim_write_t)(const vtss_inst_t    inst,
                                      const u8             addr,
                                      const u16            value);
 
+/** \brief MII management register access, used for access lists */
+typedef mepa_miim_access_t vtss_phy_miim_access_t;
+
+/**
+ * \brief MII management access list function (IEEE 802.3 clause 22).
+ * The accesses are done in list order.
+ *
+ * \param inst [IN]     Target instance reference.
+ * \param port_no [IN]  Port number
+ * \param cnt [IN]      Number of entries in list
+ * \param list [IN/OUT] List of accesses. The value is updated for read accesses.
+ *
+ * \return Return code.
+ **/
+typedef vtss_rc (*vtss_phy_miim_access_list_t)(const vtss_inst_t            inst,
+                                               const vtss_port_no_t         port_no,
+                                               const u32                    cnt,
+                                               vtss_phy_miim_access_t *const list);
+
 /**
  * \brief MMD management read function (IEEE 802.3 clause 45)
  *
@@ -584,6 +603,7 @@ typedef struct {
     vtss_mmd_read_t          mmd_read;          /**< MMD management read function */
     vtss_mmd_read_inc_t      mmd_read_inc;      /**< MMD management read increment function */
     vtss_mmd_write_t         mmd_write;         /**< MMD management write function */
+    vtss_phy_miim_access_list_t miim_access_list; /**< MII management access list function (optional) */
     vtss_spi_read_write_t    spi_read_write;    /**< Board specific SPI read/write callout function */
     vtss_spi_32bit_read_write_t spi_32bit_read_write; /**< Board specific SPI read/write callout function for 32 bit data */
     vtss_spi_64bit_read_write_t spi_64bit_read_write; /**< Board specific SPI read/write callout function for 64 bit data*/
@@ -1076,6 +1076,30 @@ vtss_rc csr_wr(vtss_state_t *vtss_state, vtss_port_no_t port_no, u16 mmd, BOOL i
     return VTSS_RC_OK;
 }
 
+/* Write 'cnt' consecutive 32-bit CSRs starting at 'addr'. On the 1G MDIO path the CSR window */
+/* page and target are set up once for the whole block instead of once per register.        */
+vtss_rc csr_wr_inc(vtss_state_t *vtss_state, vtss_port_no_t port_no, u16 mmd, BOOL is32, u32 addr, const u32 *value, u32 cnt)
+{
+    u32 i;
+#ifdef VTSS_CHIP_CU_PHY
+    BOOL clause45 = FALSE, use_base_port = TRUE;
+    u32  offset, target, base_addr;
+
+    VTSS_RC(phy_type_get(vtss_state, port_no, &clause45));
+    if (!clause45 && is32 &&
+        vtss_state->init_conf.spi_read_write == NULL &&
+        vtss_state->init_conf.spi_32bit_read_write == NULL) {
+        VTSS_RC(get_base_adr(vtss_state, port_no, mmd, addr, &base_addr, &target, &offset, &use_base_port));
+        VTSS_N("1G WR_INC port %u : reg %0xX%0x cnt %u", port_no, mmd, addr, cnt);
+        return vtss_phy_macsec_csr_wr_inc_private(vtss_state, port_no, target, offset, value, cnt);
+    }
+#endif /* VTSS_CHIP_CU_PHY */
+    for (i = 0; i < cnt; i++) {
+        VTSS_RC(csr_wr(vtss_state, port_no, mmd, is32, addr + i, value[i]));
+    }
+    return VTSS_RC_OK;
+}
+
 
 vtss_rc csr_wrm(vtss_state_t *vtss_state, vtss_port_no_t port_no, u16 mmd, BOOL is32, u32 addr, u32 value, u32 mask)
 {
@@ -359,6 +359,14 @@ typedef struct {
 } vtss_phy_ts_new_spi_conf_t;
 #endif /* defined(VTSS_CHIP_CU_PHY) && defined(VTSS_PHY_TS_SPI_CLK_THRU_PPS0) */
 
+/* Direct mapped shadow of the analyzer (configuration) CSRs, kept on the base port */
+#define VTSS_PHY_TS_CSR_SHADOW_SIZE 256
+
+typedef struct {
+    u16                      key;   /* ((blk_id << 11) | csr_address) + 1, 0 if unused */
+    u32                      value;
+} vtss_phy_ts_csr_shadow_t;
+
 typedef struct {
     BOOL                             port_ts_init_done; /* PHY TS init done */
     BOOL                             eng_init_done; /* 1588 TS engine init done */
@@ -412,6 +420,10 @@ typedef struct {
     BOOL                             one_step_txfifo;
     u8                               ip1_nxt_cmp[4]; /* IP1 comparator is available only in blocks 0,1,2,3. */
     u8                               ip2_nxt_cmp[4]; /* IP2 comparator is available only in blocks 0,1,2,3. */
+    vtss_phy_ts_csr_shadow_t         csr_shadow[VTSS_PHY_TS_CSR_SHADOW_SIZE];
+    u32                              csr_rd_hit_cnt; /* Analyzer CSR reads served from the shadow */
+    u32                              csr_rd_miss_cnt; /* Analyzer CSR reads done on the PHY */
+    u32                              csr_wr_skip_cnt; /* Analyzer CSR writes elided by the shadow */
 } vtss_phy_ts_port_conf_t;
 
 typedef struct {
@@ -17,6 +17,8 @@
 #define VTSS_MACSEC_10G_MAX_SC_TX  VTSS_MACSEC_10G_MAX_SC_RX
 #define VTSS_MACSEC_10G_MAX_SECY   VTSS_MACSEC_10G_MAX_SC_TX
 
+#define VTSS_MACSEC_RX_SC_HASH_SIZE 16 /* SCI hash buckets per port, power of 2 */
+
 #define VTSS_MACSEC_ACTION_MAX 3
 #define VTSS_MACSEC_DIRECTION_MAX 3
 #define VTSS_MACSEC_MTU_MAX    32761 /**<Maximum supported MTU for MACSEC*/
@@ -50,6 +52,8 @@ typedef struct {
     vtss_macsec_rx_sc_conf_t     conf;
     vtss_macsec_rx_sa_counters_t del_rx_sa_cnt;
     u64                          in_octets_validation_disabled;
+    u8                           secy_sc;   /* Index in secy->rx_sc[] */
+    u8                           hash_next; /* Next rx_sc[] index + 1 in the SCI hash chain, 0 terminates */
 } vtss_macsec_internal_rx_sc_t;
 
 typedef struct {
@@ -94,6 +98,8 @@ typedef struct {
     BOOL                                   rmon_counters_clr; /** MACsec RMON counters clear flag */
     BOOL                                   spd_change_macsec_recfg; /** MACsec Reconfig flag for speed change */
     u64                                    ingr_flow_map; /** ingress flow map */
+    u64                                    rx_record_map; /** ingress SA records in use */
+    u64                                    tx_record_map; /** egress SA records in use */
     u8                                     recfg_speed;
 } vtss_macsec_internal_glb_t;
 
@@ -103,6 +109,7 @@ typedef struct {
     vtss_macsec_internal_rx_sc_t        rx_sc[VTSS_MACSEC_MAX_SC_RX];
     vtss_macsec_internal_rx_sa_t        rx_sa[VTSS_MACSEC_MAX_SA_RX];
     vtss_macsec_internal_tx_sa_t        tx_sa[VTSS_MACSEC_MAX_SA_TX];
+    u8                                  rx_sc_hash[VTSS_MACSEC_RX_SC_HASH_SIZE]; /* SCI hash, rx_sc[] index + 1 */
     vtss_macsec_internal_glb_t          glb;
     vtss_macsec_rc_dbg_counters_t       rc_dbg_counters;
 } vtss_macsec_internal_conf_t;
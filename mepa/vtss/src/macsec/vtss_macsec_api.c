@@ -719,6 +719,69 @@ static BOOL sci_cmp(const vtss_macsec_sci_t *a, const vtss_macsec_sci_t *b)
     return TRUE;
 }
 
+/* The low MAC octets and the port id carry nearly all of the entropy of an SCI */
+static u32 sci_hash(const vtss_macsec_sci_t *sci)
+{
+    return (sci->mac_addr.addr[4] ^ sci->mac_addr.addr[5] ^ sci->port_id ^ (sci->port_id >> 8)) &
+           (VTSS_MACSEC_RX_SC_HASH_SIZE - 1);
+}
+
+/* Find an in-use RX SC of the port by SCI. Returns the index in macsec_conf.rx_sc[] or -1 */
+static i32 rx_sc_hash_find(vtss_state_t *vtss_state, vtss_port_no_t port_no, const vtss_macsec_sci_t *sci)
+{
+    vtss_macsec_internal_conf_t *conf = &vtss_state->macsec_conf[port_no];
+    u32 idx;
+
+    for (idx = conf->rx_sc_hash[sci_hash(sci)]; idx != 0; idx = conf->rx_sc[idx - 1].hash_next) {
+        if (conf->rx_sc[idx - 1].in_use && sci_cmp(sci, &conf->rx_sc[idx - 1].sci)) {
+            return idx - 1;
+        }
+    }
+    return -1;
+}
+
+static void rx_sc_hash_add(vtss_state_t *vtss_state, vtss_port_no_t port_no, u32 sc_conf)
+{
+    vtss_macsec_internal_conf_t *conf = &vtss_state->macsec_conf[port_no];
+    u32 h = sci_hash(&conf->rx_sc[sc_conf].sci);
+
+    conf->rx_sc[sc_conf].hash_next = conf->rx_sc_hash[h];
+    conf->rx_sc_hash[h] = sc_conf + 1;
+}
+
+static void rx_sc_hash_del(vtss_state_t *vtss_state, vtss_port_no_t port_no, u32 sc_conf)
+{
+    vtss_macsec_internal_conf_t *conf = &vtss_state->macsec_conf[port_no];
+    u8 *link = &conf->rx_sc_hash[sci_hash(&conf->rx_sc[sc_conf].sci)];
+
+    while (*link != 0) {
+        if (*link == sc_conf + 1) {
+            *link = conf->rx_sc[sc_conf].hash_next;
+            conf->rx_sc[sc_conf].hash_next = 0;
+            return;
+        }
+        link = &conf->rx_sc[*link - 1].hash_next;
+    }
+}
+
+/* Keep the SA record 'in_use' flag and the free-record bitmap in step */
+static void record_in_use_set(vtss_state_t *vtss_state, vtss_port_no_t port_no, u32 record, BOOL egr, BOOL in_use)
+{
+    vtss_macsec_internal_conf_t *conf = &vtss_state->macsec_conf[port_no];
+    u64 *map = egr ? &conf->glb.tx_record_map : &conf->glb.rx_record_map;
+
+    if (egr) {
+        conf->tx_sa[record].in_use = in_use;
+    } else {
+        conf->rx_sa[record].in_use = in_use;
+    }
+    if (in_use) {
+        *map |= ((u64)1 << record);
+    } else {
+        *map &= ~((u64)1 << record);
+    }
+}
+
 static BOOL sci_larger(const vtss_macsec_sci_t *a, const vtss_macsec_sci_t *b)
 {
     u32 i;
@@ -808,26 +871,18 @@ static BOOL macsec_secy_in_use_inter_getnext(vtss_state_t        *vtss_state,
 
 static vtss_rc sc_from_sci_get(vtss_state_t *vtss_state, vtss_port_no_t port_no, vtss_macsec_internal_secy_t *secy, const vtss_macsec_sci_t *sci, u32 *sc)
 {
-    u32 i, max_sc_rx;
+    vtss_macsec_internal_rx_sc_t *rx_sc;
+    i32 sc_conf;
 
-    if (phy_is_1g(vtss_state, port_no)) {
-        max_sc_rx = VTSS_MACSEC_1G_MAX_SC_RX;
-    } else {
-        max_sc_rx = VTSS_MACSEC_10G_MAX_SC_RX;
-    }
-
-    for (i = 0; i < max_sc_rx; i++) {
-        if (secy->rx_sc[i] == NULL) {
-            continue;
-        }
-        if (secy->rx_sc[i]->in_use) {
-            if (sci_cmp(sci, &secy->rx_sc[i]->sci)) {
-                *sc = i;
-                return VTSS_RC_OK;
-            }
+    // SCIs are unique per port, so a hash hit is the SC as long as it belongs to this SecY
+    if ((sc_conf = rx_sc_hash_find(vtss_state, port_no, sci)) >= 0) {
+        rx_sc = &vtss_state->macsec_conf[port_no].rx_sc[sc_conf];
+        if (rx_sc->secy_sc < VTSS_MACSEC_MAX_SC_RX && secy->rx_sc[rx_sc->secy_sc] == rx_sc) {
+            *sc = rx_sc->secy_sc;
+            return VTSS_RC_OK;
         }
     }
-    VTSS_I("Error-i:%u", i);
+    VTSS_I("SC not found, port_no:%u", port_no);
     return dbg_counter_incr(vtss_state, port_no, VTSS_RC_ERR_MACSEC_SC_NOT_FOUND);
 }
 
@@ -1761,6 +1816,7 @@ static vtss_rc vtss_macsec_init_set_priv(vtss_state_t                      *vtss
                     // Since SA flows shall be reallocated for CP again, the resource shall be released again
                     record = vtss_state->macsec_conf[port_no].glb.egr_bypass_record[i];
                     memset(&(vtss_state->macsec_conf[port_no].tx_sa[record]), 0, sizeof(vtss_macsec_internal_tx_sa_t));
+                    record_in_use_set(vtss_state, port_no, record, EGRESS, FALSE);
                     vtss_state->macsec_conf[port_no].glb.egr_bypass_record[i] = MACSEC_NOT_IN_USE;
                 }
             }
@@ -2413,24 +2469,20 @@ static vtss_rc record_empty_get(vtss_state_t *vtss_state,
                                 vtss_port_no_t port_no, u32 *id, BOOL tx)
 {
     u32 sa, max_sa;
+    u64 map;
     if (phy_is_1g(vtss_state, port_no)) {
         max_sa = VTSS_MACSEC_1G_MAX_SA;
     } else {
         max_sa = VTSS_MACSEC_10G_MAX_SA;
     }
-    if (tx) {
-        for (sa = 0; sa < max_sa; sa++) {
-            if (!vtss_state->macsec_conf[port_no].tx_sa[sa].in_use) {
-                *id = sa;
-                return VTSS_RC_OK;
-            }
+    map = tx ? vtss_state->macsec_conf[port_no].glb.tx_record_map : vtss_state->macsec_conf[port_no].glb.rx_record_map;
+    if (~map != 0) {
+        for (sa = 0; (map & 1) != 0; sa++) {
+            map >>= 1;
         }
-    } else {
-        for (sa = 0; sa < max_sa; sa++) {
-            if (!vtss_state->macsec_conf[port_no].rx_sa[sa].in_use) {
-                *id = sa;
-                return VTSS_RC_OK;
-            }
+        if (sa < max_sa) {
+            *id = sa;
+            return VTSS_RC_OK;
         }
     }
 
@@ -2731,6 +2783,7 @@ static vtss_rc macsec_sa_xform_set(vtss_state_t *vtss_state, vtss_port_no_t p, B
     BOOL xpn = FALSE;
     u32 i;
     u8 xform_rec_size = (egr & vtss_state->macsec_conf[p].glb.macsec_revb) ? 24 : 20;
+    u32 xform[24];
 
     VTSS_D("Record:%u SC:%u SA:%u  Dir:%s ", record, sc, an, egr ? "Egress" : "Ingress");
 
@@ -2746,28 +2799,19 @@ static vtss_rc macsec_sa_xform_set(vtss_state_t *vtss_state, vtss_port_no_t p, B
         aes_128 = (secy->conf.current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_128) ? 1 : 0;
 
         for (i = 0; i < xform_rec_size; i++) {
-            if (egr) {
-                VTSS_RC(csr_wr(vtss_state, p, 0x1f, 1, ((0x8000 + i) | (record * 32)), get_xform_value(vtss_state, p, i, egr, aes_128, secy, an, sc, record)));
-            } else {
-                VTSS_RC(csr_wr(vtss_state, p, 0x1f, 1, ((0x0000 + i) | (record * 32)), get_xform_value(vtss_state, p, i, egr, aes_128, secy, an, sc, record)));
-            }
+            xform[i] = get_xform_value(vtss_state, p, i, egr, aes_128, secy, an, sc, record);
         }
     } else {
         aes_128 = (secy->conf.current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_XPN_128) ? TRUE : FALSE;
+        xform_rec_size = egr ? 24 : 20;
 
-        for (i = 0; i < 24; i++) {
-            if (egr) {
-                VTSS_RC(csr_wr(vtss_state, p, 0x1f, 1, ((0x8000 + i) | (record * 32)), get_xform_value_64(vtss_state, p, i, egr, aes_128, secy, an, sc, record)));
-            } else {
-                if (i >= 20 ) {
-                    break;
-                }
-                VTSS_RC(csr_wr(vtss_state, p, 0x1f, 1, ((0x0000 + i) | (record * 32)), get_xform_value_64(vtss_state, p, i, egr, aes_128, secy, an, sc, record)));
-            }
+        for (i = 0; i < xform_rec_size; i++) {
+            xform[i] = get_xform_value_64(vtss_state, p, i, egr, aes_128, secy, an, sc, record);
         }
     }
 
-    return VTSS_RC_OK;
+    // The transform record is one contiguous block of CSRs, program it in one go
+    return csr_wr_inc(vtss_state, p, 0x1f, 1, ((egr ? 0x8000 : 0x0000) | (record * 32)), xform, xform_rec_size);
 }
 
 static vtss_rc macsec_sa_xform_reset(vtss_state_t *vtss_state,
@@ -2779,6 +2823,7 @@ static vtss_rc macsec_sa_xform_reset(vtss_state_t *vtss_state,
                                      u32 sc)
 {
     u32 i, count = 0;
+    u32 xform[24];
 
     VTSS_D("Record:%u SC:%u SA:%u  Dir:%s ", record, sc, an, egr ? "Egress" : "Ingress");
 
@@ -2792,13 +2837,9 @@ static vtss_rc macsec_sa_xform_reset(vtss_state_t *vtss_state,
         count = 20;
     }
     for (i = 0; i < count; i++) {
-        if (egr) {
-            VTSS_RC(csr_wr(vtss_state, p, 0x1f, 1, ((0x8000 + i) | (record * 32)), 0));
-        } else {
-            VTSS_RC(csr_wr(vtss_state, p, 0x1f, 1, ((0x0000 + i) | (record * 32)), 0));
-        }
+        xform[i] = 0;
     }
-    return VTSS_RC_OK;
+    return csr_wr_inc(vtss_state, p, 0x1f, 1, ((egr ? 0x8000 : 0x0000) | (record * 32)), xform, count);
 }
 
 static vtss_rc record_inuse_get(vtss_state_t *vtss_state, vtss_port_no_t p, BOOL egr,
@@ -3126,11 +3167,10 @@ static vtss_rc vtss_macsec_pattern_set_priv(vtss_state_t                       *
 
     if (egr) {
         vtss_state->macsec_conf[port_no].tx_sa[record].record = record;
-        vtss_state->macsec_conf[port_no].tx_sa[record].in_use = 1;
     } else {
         vtss_state->macsec_conf[port_no].rx_sa[record].record = record;
-        vtss_state->macsec_conf[port_no].rx_sa[record].in_use = 1;
     }
+    record_in_use_set(vtss_state, port_no, record, egr, TRUE);
     if (secy != NULL) {
         secy->pattern_record[action][direction] = record;
     } else {
@@ -3405,7 +3445,7 @@ static vtss_rc vtss_macsec_control_frame_match_conf_set_priv(vtss_state_t
                 return dbg_counter_incr(vtss_state, port_no, VTSS_RC_ERR_MACSEC_COULD_NOT_SET_SA);
             }
 
-            vtss_state->macsec_conf[port_no].tx_sa[record].in_use = 0;
+            record_in_use_set(vtss_state, port_no, record, EGRESS, FALSE);
             vtss_state->macsec_conf[port_no].glb.egr_bypass_record[*rule_id] = MACSEC_NOT_IN_USE;
             vtss_state->macsec_conf[port_no].glb.control_match[*rule_id].match = VTSS_MACSEC_MATCH_DISABLE;
         }
@@ -3683,6 +3723,7 @@ static vtss_rc vtss_macsec_tx_sa_del_priv(vtss_state_t              *vtss_state,
     }
 
     memset(&vtss_state->macsec_conf[port.port_no].tx_sa[record], 0, sizeof(vtss_state->macsec_conf[port.port_no].tx_sa[record]));
+    record_in_use_set(vtss_state, port.port_no, record, EGRESS, FALSE);
     secy->tx_sc.sa[an] = NULL;
     /* Clear Hardware config registers */
     VTSS_D("Port:%d, secy_id:%u AN:%u, Record:%u, Hardware Registers clear", port.port_no, secy_id, an, record);
@@ -4218,6 +4259,7 @@ static vtss_rc vtss_macsec_rx_sa_del_priv(vtss_state_t              *vtss_state,
         secy->rx_sc[sc]->status.stopped_time = secy->rx_sc[sc]->sa[an]->status.stopped_time;
     }
     memset(&vtss_state->macsec_conf[port.port_no].rx_sa[record], 0, sizeof(vtss_state->macsec_conf[port.port_no].rx_sa[record]));
+    record_in_use_set(vtss_state, port.port_no, record, INGRESS, FALSE);
     secy->rx_sc[sc]->sa[an] = NULL;
 
     /* Clear Hardware config registers */
@@ -4261,6 +4303,7 @@ static vtss_rc vtss_macsec_rx_sc_del_priv(vtss_state_t              *vtss_state,
             }
         }
     }
+    rx_sc_hash_del(vtss_state, port.port_no, secy->rx_sc[sc] - vtss_state->macsec_conf[port.port_no].rx_sc);
     memset(secy->rx_sc[sc], 0, sizeof(*secy->rx_sc[sc]));
     secy->rx_sc[sc] = NULL;
     VTSS_RC(macsec_update_glb_validate(vtss_state, port.port_no));
@@ -4320,7 +4363,7 @@ static vtss_rc vtss_macsec_pattern_del_priv(vtss_state_t                       *
         return dbg_counter_incr(vtss_state, port.port_no, VTSS_RC_ERR_MACSEC_COULD_NOT_SET_SA);
     }
     if (egr) {
-        vtss_state->macsec_conf[port.port_no].tx_sa[record].in_use = 0;
+        record_in_use_set(vtss_state, port.port_no, record, EGRESS, FALSE);
         /* Clear Hardware config registers */
         VTSS_D("Port:%d, secy_id:%u Record:%u, Hardware Registers clear", port.port_no, secy_id, record);
         CSR_WARM_WR(port.port_no, VTSS_MACSEC_EGR_SA_MATCH_FLOW_CONTROL_PARAMS_EGR_SAM_FLOW_CTRL_EGR(record), 0);
@@ -4329,7 +4372,7 @@ static vtss_rc vtss_macsec_pattern_del_priv(vtss_state_t                       *
             return dbg_counter_incr(vtss_state, port.port_no, VTSS_RC_ERR_MACSEC_COULD_NOT_PRG_SA_MATCH);
         }
     } else {
-        vtss_state->macsec_conf[port.port_no].rx_sa[record].in_use = 0;
+        record_in_use_set(vtss_state, port.port_no, record, INGRESS, FALSE);
         /* Clear Hardware config registers */
         VTSS_D("Port:%d, secy_id:%u Record:%u, Hardware Registers clear", port.port_no, secy_id, record);
         CSR_WARM_WR(port.port_no, VTSS_MACSEC_INGR_SA_MATCH_FLOW_CONTROL_PARAMS_IGR_SAM_FLOW_CTRL_IGR(record), 0);
@@ -4601,12 +4644,9 @@ static vtss_rc vtss_macsec_rx_sc_add_priv(vtss_state_t              *vtss_state,
         max_sc_rx = VTSS_MACSEC_10G_MAX_SC_RX;
     }
 
-    for (sc = 0; sc < max_sc_rx; sc++) {
-        if (sci_cmp(sci, &vtss_state->macsec_conf[port.port_no].rx_sc[sc].sci)) {
-            VTSS_E("SCI already exists, port_no:%d  port_id:%d, secy_id:%d", port.port_no, port.port_id, secy_id);
-            return dbg_counter_incr(vtss_state, port.port_no, VTSS_RC_ERR_MACSEC_SCI_ALREADY_EXISTS);
-        }
-
+    if (rx_sc_hash_find(vtss_state, port.port_no, sci) >= 0) {
+        VTSS_E("SCI already exists, port_no:%d  port_id:%d, secy_id:%d", port.port_no, port.port_id, secy_id);
+        return dbg_counter_incr(vtss_state, port.port_no, VTSS_RC_ERR_MACSEC_SCI_ALREADY_EXISTS);
     }
 
     for (sc = 0; sc < max_sc_rx; sc++) {
@@ -4640,6 +4680,8 @@ static vtss_rc vtss_macsec_rx_sc_add_priv(vtss_state_t              *vtss_state,
     MEPA_TIME_OF_DAY(tod);
     secy->rx_sc[sc_secy]->status.created_time = tod.sec; // TimeOfDay in seconds
     secy->rx_sc[sc_secy]->in_use = 1;
+    secy->rx_sc[sc_secy]->secy_sc = sc_secy;
+    rx_sc_hash_add(vtss_state, port.port_no, sc_conf);
 
     return VTSS_RC_OK;
 }
@@ -4753,7 +4795,7 @@ static vtss_rc vtss_macsec_rx_sa_set_priv(vtss_state_t                  *vtss_st
         }
         secy->rx_sc[sc]->sa[an]->status.lowest_pn = lowest_pn.pn;
         secy->rx_sc[sc]->sa[an]->status.pn_status.lowest_pn = lowest_pn; // Rev-B
-        secy->rx_sc[sc]->sa[an]->in_use = 1;
+        record_in_use_set(vtss_state, port.port_no, record, INGRESS, TRUE);
         MEPA_TIME_OF_DAY(tod);
         secy->rx_sc[sc]->sa[an]->status.created_time = tod.sec; // TimeOfDay in seconds
     }
@@ -4955,6 +4997,8 @@ static vtss_rc vtss_macsec_rx_sa_lowest_pn_update_priv(vtss_state_t
             memcpy(&vtss_state->macsec_conf[port.port_no].rx_sa[new_record],
                    &vtss_state->macsec_conf[port.port_no].rx_sa[record], sizeof(vtss_macsec_internal_rx_sa_t));
             memset(&vtss_state->macsec_conf[port.port_no].rx_sa[record], 0, sizeof(vtss_state->macsec_conf[port.port_no].rx_sa[record]));
+            record_in_use_set(vtss_state, port.port_no, record, INGRESS, FALSE);
+            record_in_use_set(vtss_state, port.port_no, new_record, INGRESS, TRUE);
             secy->rx_sc[sc]->sa[an] = &vtss_state->macsec_conf[port.port_no].rx_sa[new_record];
             secy->rx_sc[sc]->sa[an]->record = new_record;
 
@@ -5157,7 +5201,7 @@ static vtss_rc vtss_macsec_tx_sa_set_priv(vtss_state_t                   *vtss_s
             secy->tx_sc.sa[an]->status.next_pn = next_pn.pn - 1;
         }
         secy->tx_sc.sa[an]->status.pn_status.next_pn = next_pn;
-        secy->tx_sc.sa[an]->in_use = 1;
+        record_in_use_set(vtss_state, port.port_no, record, EGRESS, TRUE);
         MEPA_TIME_OF_DAY(tod);
         secy->tx_sc.sa[an]->status.created_time = tod.sec; // TimeOfDay in seconds
     }
@@ -8383,6 +8427,54 @@ vtss_rc vtss_macsec_tx_sa_activate(const vtss_inst_t         inst,
     return rc;
 }
 
+vtss_rc vtss_macsec_sa_rollover(const vtss_inst_t         inst,
+                                const vtss_macsec_port_t  port,
+                                const u16                 an,
+                                const u32                 next_pn,
+                                const u32                 lowest_pn,
+                                const BOOL                confidentiality,
+                                const vtss_macsec_sak_t   *const sak,
+                                const BOOL                activate)
+{
+    vtss_macsec_internal_secy_t *secy;
+    vtss_state_t *vtss_state;
+    vtss_rc rc = VTSS_RC_ERROR;
+    u32 secy_id = 0, sc;
+    vtss_macsec_pkt_num_t rx_pn, tx_pn;
+
+    VTSS_I(MPORT_AN_FMT" next_pn:%u lowest_pn:%u confidentiality:%d activate:%d", MPORT_AN_ARG(port, an),
+           next_pn, lowest_pn, confidentiality, activate);
+    prnt_sak(sak);
+    rx_pn.pn = lowest_pn;
+    tx_pn.pn = next_pn;
+    VTSS_ENTER();
+    if ((rc = vtss_macsec_port_check(inst, &vtss_state, port, 0, &secy_id)) == VTSS_RC_OK) {
+        secy = &vtss_state->macsec_conf[port.port_no].secy[secy_id];
+        if (secy->conf.current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_XPN_128 ||
+            secy->conf.current_cipher_suite == VTSS_MACSEC_CIPHER_SUITE_GCM_AES_XPN_256) {
+            VTSS_E("SA rollover is not supported for XPN cipher suites, port_no:%u", port.port_no);
+            rc = VTSS_RC_ERROR;
+        }
+        // Install and enable the new key on every receiver before the transmitter switches to it
+        for (sc = 0; sc < VTSS_MACSEC_MAX_SC_RX && rc == VTSS_RC_OK; sc++) {
+            if (secy->rx_sc[sc] == NULL || !secy->rx_sc[sc]->in_use) {
+                continue;
+            }
+            if ((rc = vtss_macsec_rx_sa_set_priv(vtss_state, secy_id, port, &secy->rx_sc[sc]->sci, an, rx_pn, sak, NULL)) == VTSS_RC_OK) {
+                rc = vtss_macsec_rx_sa_activate_priv(vtss_state, secy_id, port, &secy->rx_sc[sc]->sci, an);
+            }
+        }
+        if (rc == VTSS_RC_OK) {
+            rc = vtss_macsec_tx_sa_set_priv(vtss_state, secy_id, port, an, tx_pn, confidentiality, sak, NULL);
+        }
+        if (rc == VTSS_RC_OK && activate) {
+            rc = vtss_macsec_tx_sa_activate_priv(vtss_state, secy_id, port, an);
+        }
+    }
+    VTSS_EXIT();
+    return rc;
+}
+
 vtss_rc vtss_macsec_tx_sa_disable(const vtss_inst_t         inst,
                                   const vtss_macsec_port_t  port,
                                   const u16                 an)
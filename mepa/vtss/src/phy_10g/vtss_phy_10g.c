@@ -3366,6 +3366,9 @@ vtss_rc vtss_phy_10g_reset(const vtss_inst_t    inst,
 
     VTSS_ENTER();
     if ((rc = vtss_inst_phy_10G_no_check_private(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+#if defined(VTSS_OPT_PHY_TIMESTAMP)
+        vtss_phy_ts_csr_shadow_clear_all(vtss_state);
+#endif
         rc = VTSS_RC_COLD(vtss_phy_10g_reset_private(vtss_state, port_no));
     }
     VTSS_EXIT();
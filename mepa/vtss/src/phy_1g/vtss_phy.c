@@ -45,6 +45,10 @@ static BOOL do_page_chk = TRUE;
 static BOOL do_page_chk = FALSE;
 #endif
 
+// The page check uses the page register cache when it is valid. By setting the page_cache_verify variable the page register
+// is read back instead, and an error is given if the cache doesn't match the chip. Used for verifying the page cache.
+static BOOL page_cache_verify = FALSE;
+
 #if defined(VTSS_FEATURE_MACSEC)
 extern vtss_rc vtss_macsec_drop_all_traffic_priv(vtss_state_t *vtss_state,
                                                  const vtss_port_no_t port_no);
@@ -419,6 +423,130 @@ static vtss_rc vtss_phy_i2c_rd_private(vtss_state_t *vtss_state, vtss_port_no_t
 }
 
 
+// Page register cache.
+// Each port remembers the page last written to register 31, so that selecting the page which is already active
+// doesn't cost an MDIO write. The cache is invalidated whenever the page register may have changed behind our back
+// (port/chip reset, coma mode, SMI broadcast writes, direct MIIM access and access errors).
+void vtss_phy_page_cache_invalidate(vtss_state_t *vtss_state, const vtss_port_no_t port_no)
+{
+    vtss_state->phy_state[port_no].page_valid = FALSE;
+}
+
+// Invalidate the page cache for all ports in the instance
+void vtss_phy_page_cache_invalidate_all(vtss_state_t *vtss_state)
+{
+    vtss_port_no_t port_no;
+
+    for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
+        vtss_state->phy_state[port_no].page_valid = FALSE;
+    }
+}
+
+// Write the page register, skipping the write if the page is already selected
+static vtss_rc vtss_phy_page_sel(vtss_state_t *vtss_state, const vtss_port_no_t port_no, const u16 page)
+{
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+    vtss_rc               rc;
+
+    if (ps->page_valid && ps->page_cur == page && !vtss_state->phy_inst_state.page_bcast) {
+        ps->page_skip_cnt++;
+        return VTSS_RC_OK;
+    }
+
+    ps->mdio_wr_cnt++;
+    if ((rc = vtss_state->init_conf.miim_write(vtss_state, port_no, 31, page)) == VTSS_RC_OK) {
+        ps->page_cur = page;
+        // During SMI broadcast the page register of the other ports in the chip is changed too, so don't trust the cache.
+        ps->page_valid = !vtss_state->phy_inst_state.page_bcast;
+    } else {
+        ps->page_valid = FALSE;
+    }
+    return rc;
+}
+
+// Track writes to the extended control register (register 22, standard page), which holds the SMI broadcast enable.
+static void vtss_phy_page_bcast_chk(vtss_state_t *vtss_state, const vtss_port_no_t port_no, const u16 page, const u16 reg, const u16 val)
+{
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+
+    if (reg != 22 || page != VTSS_PHY_PAGE_STANDARD || (ps->page_valid && ps->page_cur != VTSS_PHY_PAGE_STANDARD)) {
+        return; // Not the standard page register 22 (pages encoded in the address are never the standard page)
+    }
+    // Broadcast enabled or disabled. Either way the page register of the other ports may have changed
+    vtss_state->phy_inst_state.page_bcast = ((val & 0x0001) ? TRUE : FALSE);
+    vtss_phy_page_cache_invalidate_all(vtss_state);
+}
+
+// Add an access to a MIIM access list
+static void vtss_phy_access_add(vtss_phy_port_state_t *ps, vtss_phy_miim_access_t *list, u32 *cnt, BOOL write, u16 reg, u16 value)
+{
+    vtss_phy_miim_access_t *access = &list[*cnt];
+
+    access->mmd = 0;
+    access->addr = reg;
+    access->write = write;
+    access->value = value;
+    (*cnt)++;
+    if (write) {
+        ps->mdio_wr_cnt++;
+    } else {
+        ps->mdio_rd_cnt++;
+    }
+}
+
+// Paged register access done using the MIIM access list callout, so that the page select, the register access and
+// the restore of the standard page are handed to the board in one call. Read-modify-write needs two calls.
+static vtss_rc vtss_phy_rd_wr_list(vtss_state_t         *vtss_state,
+                                   BOOL                 read,
+                                   const vtss_port_no_t port_no,
+                                   const u16            page,
+                                   const u16            reg,
+                                   u16                  *const value,
+                                   const u16            mask)
+{
+    vtss_phy_port_state_t  *ps = &vtss_state->phy_state[port_no];
+    vtss_phy_miim_access_t list[3];
+    u32                    cnt = 0;
+    u16                    val = *value;
+    vtss_rc                rc;
+
+    if (ps->page_valid && ps->page_cur == page && !vtss_state->phy_inst_state.page_bcast) {
+        ps->page_skip_cnt++;
+    } else {
+        vtss_phy_access_add(ps, list, &cnt, TRUE, 31, page);
+    }
+    if (read || mask != 0xffff) {
+        vtss_phy_access_add(ps, list, &cnt, FALSE, reg, 0);
+    }
+    if (!read && mask != 0xffff) {
+        /* Read-modify-write, the write depends on the read value */
+        if ((rc = vtss_state->init_conf.miim_access_list(vtss_state, port_no, cnt, list)) != VTSS_RC_OK) {
+            ps->page_valid = FALSE;
+            return rc;
+        }
+        ps->page_cur = page;
+        ps->page_valid = !vtss_state->phy_inst_state.page_bcast;
+        val = (list[cnt - 1].value & ~mask) | (*value & mask);
+        cnt = 0;
+    }
+    if (!read) {
+        vtss_phy_access_add(ps, list, &cnt, TRUE, reg, val);
+    }
+    vtss_phy_access_add(ps, list, &cnt, TRUE, 31, VTSS_PHY_PAGE_STANDARD);
+
+    if ((rc = vtss_state->init_conf.miim_access_list(vtss_state, port_no, cnt, list)) == VTSS_RC_OK) {
+        if (read) {
+            *value = list[cnt - 2].value;
+        }
+        ps->page_cur = VTSS_PHY_PAGE_STANDARD;
+        ps->page_valid = !vtss_state->phy_inst_state.page_bcast;
+    } else {
+        ps->page_valid = FALSE;
+    }
+    VTSS_N("%s - port:%d, page:0x%X, reg:0x%X, value:0x%X, mask:0x%X", read ? "Read" : "Write", port_no, page, reg, read ? *value : val, mask);
+    return rc;
+}
+
 static vtss_rc vtss_phy_rd_wr_masked(vtss_state_t         *vtss_state,
                                      BOOL                 read,
                                      const vtss_port_no_t port_no,
@@ -426,10 +554,11 @@ static vtss_rc vtss_phy_rd_wr_masked(vtss_state_t         *vtss_state,
                                      u16                  *const value,
                                      const u16            mask)
 {
-    vtss_rc           rc = VTSS_RC_OK;
-    vtss_miim_read_t  read_func;
-    vtss_miim_write_t write_func;
-    u16               reg, page, val;
+    vtss_rc               rc = VTSS_RC_OK;
+    vtss_miim_read_t      read_func;
+    vtss_miim_write_t     write_func;
+    vtss_phy_port_state_t *ps = &vtss_state->phy_state[port_no];
+    u16                   reg, page, val = 0;
 
     /* Setup read/write function pointers */
     read_func = vtss_state->init_conf.miim_read;
@@ -439,26 +568,44 @@ static vtss_rc vtss_phy_rd_wr_masked(vtss_state_t         *vtss_state,
     page = (addr >> 5);
     reg = (addr & 0x1f);
 
+    if (!read && reg == 31 && page == VTSS_PHY_PAGE_STANDARD && mask == 0xffff) {
+        /* Page select */
+        return vtss_phy_page_sel(vtss_state, port_no, *value);
+    }
+
+    if (page && vtss_state->init_conf.miim_access_list != NULL) {
+        return vtss_phy_rd_wr_list(vtss_state, read, port_no, page, reg, value, mask);
+    }
+
     /* Change page */
     if (page) {
-        rc = write_func(vtss_state, port_no, 31, page);
+        rc = vtss_phy_page_sel(vtss_state, port_no, page);
     }
     if (rc == VTSS_RC_OK) {
         if (read) {
             /* Read */
+            ps->mdio_rd_cnt++;
             rc = read_func(vtss_state, port_no, reg, value);
             VTSS_N("Read - port:%d, reg:0x%X, value:0x%X", port_no, reg, *value);
         } else if (mask != 0xffff) {
             /* Read-modify-write */
+            ps->mdio_rd_cnt++;
             if ((rc = read_func(vtss_state, port_no, reg, &val)) == VTSS_RC_OK) {
-                rc = write_func(vtss_state, port_no, reg, (val & ~mask) | (*value & mask));
+                ps->mdio_wr_cnt++;
+                val = (val & ~mask) | (*value & mask);
+                vtss_phy_page_bcast_chk(vtss_state, port_no, page, reg, val);
+                if ((rc = write_func(vtss_state, port_no, reg, val)) == VTSS_RC_OK && reg == 31 && page == VTSS_PHY_PAGE_STANDARD) {
+                    ps->page_cur = val;
+                    ps->page_valid = !vtss_state->phy_inst_state.page_bcast;
+                }
             }
-            VTSS_N("Read-modify-write - port:%d, reg:0x%X, rd_val:0x%X, value:0x%X, mask:0x%X  wr_val:0x%x",
-                   port_no, reg, val, *value, mask, ((val & ~mask) | (*value & mask)));
-            //VTSS_N("Read- port:%d, reg:0x%X, val:0x%X", port_no, reg, val);
+            VTSS_N("Read-modify-write - port:%d, reg:0x%X, value:0x%X, mask:0x%X  wr_val:0x%x",
+                   port_no, reg, *value, mask, val);
 
         } else {
             /* Write */
+            ps->mdio_wr_cnt++;
+            vtss_phy_page_bcast_chk(vtss_state, port_no, page, reg, *value);
             rc = write_func(vtss_state, port_no, reg, *value);
             VTSS_N("Write - port:%d, reg:0x%X, value:0x%X", port_no, reg, *value);
         }
@@ -466,9 +613,12 @@ static vtss_rc vtss_phy_rd_wr_masked(vtss_state_t         *vtss_state,
 
     /* Restore standard page */
     if (page && rc == VTSS_RC_OK) {
-        rc = write_func(vtss_state, port_no, 31, VTSS_PHY_PAGE_STANDARD);
+        rc = vtss_phy_page_sel(vtss_state, port_no, VTSS_PHY_PAGE_STANDARD);
     }
 
+    if (rc != VTSS_RC_OK) {
+        ps->page_valid = FALSE;
+    }
     return rc;
 }
 
@@ -498,6 +648,18 @@ static void vtss_phy_do_page_chk_get_private(BOOL *enable)
 
 
 
+// For debugging - See comment at the page_cache_verify
+static void vtss_phy_page_cache_verify_set_private(BOOL enable)
+{
+    page_cache_verify = enable;
+}
+
+// For debugging - See comment at the page_cache_verify
+static void vtss_phy_page_cache_verify_get_private(BOOL *enable)
+{
+    *enable = page_cache_verify;
+}
+
 // See comment at the do_page_chk
 static vtss_rc  vtss_phy_do_page_chk(vtss_state_t         *vtss_state,
                                      const vtss_port_no_t port_no,
@@ -521,7 +683,16 @@ static vtss_rc  vtss_phy_do_page_chk(vtss_state_t         *vtss_state,
         return VTSS_RC_OK;
     default:
         // Do the page check
-        VTSS_RC(vtss_phy_rd(vtss_state, port_no, 31, &current_page));
+        if (ps->page_valid && !page_cache_verify) {
+            current_page = ps->page_cur;
+        } else {
+            VTSS_RC(vtss_phy_rd(vtss_state, port_no, 31, &current_page));
+            if (ps->page_valid && ps->page_cur != current_page) {
+                VTSS_E("Page cache out of sync - Current_Page:0x%X, cached page:0x%X, line:%d, port:%d", current_page, ps->page_cur, line, port_no);
+            }
+            ps->page_cur = current_page;
+            ps->page_valid = !vtss_state->phy_inst_state.page_bcast;
+        }
         if (current_page != page) {
             VTSS_E("Unexpected page - Current_Page:0x%X, expected page:0x%X, line:%d, port:%d, family:%d", current_page, page, line, port_no, ps->family);
 
@@ -943,6 +1114,7 @@ static vtss_rc vtss_phy_soft_reset_port(vtss_state_t *vtss_state, vtss_port_no_t
                                        VTSS_F_PHY_MODE_CONTROL_SW_RESET)); // Reset phy port
             break;
         }
+        vtss_phy_page_cache_invalidate(vtss_state, port_no); // The reset restores the standard page
 
         MEPA_MSLEEP(1);/* pause after reset */
         MEPA_MTIMER_START(&timer, 5000); /* Wait up to 5 seconds */
@@ -5481,6 +5653,8 @@ static vtss_rc vtss_phy_coma_mode_private(vtss_state_t *vtss_state, const vtss_p
                                         VTSS_F_PHY_GPIO_CONTROL_2_COMA_MODE_OUTPUT_ENABLE));
     }
     VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
+    // The COMA_MODE pin is shared by all PHYs, so don't trust the page of any port across a COMA mode change
+    vtss_phy_page_cache_invalidate_all(vtss_state);
     return VTSS_RC_OK;
 }
 
@@ -8221,6 +8395,8 @@ vtss_rc vtss_phy_reset_private(vtss_state_t *vtss_state, const vtss_port_no_t po
     u16                    reg;
     BOOL                   force_reset = TRUE;
 
+    vtss_phy_page_cache_invalidate(vtss_state, port_no);
+
 
 #if defined(VTSS_FEATURE_MACSEC)
     if (vtss_phy_can(vtss_state, port_no, VTSS_CAP_MACSEC)) {
@@ -9581,6 +9757,40 @@ vtss_rc vtss_phy_macsec_csr_wr_private(vtss_state_t         *vtss_state,
     return VTSS_RC_OK;
 }
 
+// Same sequence as vtss_phy_macsec_csr_wr_private, but the page and target id are only set up once
+vtss_rc vtss_phy_macsec_csr_wr_inc_private(vtss_state_t         *vtss_state,
+                                           const vtss_port_no_t port_no,
+                                           const u16            target,
+                                           const u32            csr_reg_addr,
+                                           const u32            *value,
+                                           const u32            cnt)
+{
+    u32 target_tmp = 0, i;
+
+    if (!vtss_phy_can(vtss_state, port_no, VTSS_CAP_MACSEC) && (target == 0x38 || target == 0x3C)) {
+        VTSS_E("Port:%d, MACSEC to phy without MACSEC support", port_no);
+        return VTSS_RC_ERROR;
+    }
+
+    VTSS_RC(vtss_phy_page_macsec(vtss_state, port_no));
+    VTSS_RC(vtss_phy_wait_for_macsec_command_busy(vtss_state, port_no, 19)); // Wait for MACSEC register access
+    VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_20, VTSS_PHY_F_PAGE_MACSEC_20_TARGET((target >> 2))));
+
+    if (target >> 2 == 1 || target >> 2 == 3) {
+        target_tmp = target; // non-macsec access
+    }
+    for (i = 0; i < cnt; i++) {
+        VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_CSR_DATA_LSB, (value[i] & 0xffff)));
+        VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_CSR_DATA_MSB, (value[i] >> 16)));
+        VTSS_RC(PHY_WR_PAGE(vtss_state, port_no, VTSS_PHY_PAGE_MACSEC_19,  VTSS_PHY_F_PAGE_MACSEC_19_CMD_BIT |
+                            VTSS_PHY_F_PAGE_MACSEC_19_TARGET(target_tmp) | VTSS_PHY_F_PAGE_MACSEC_19_CSR_REG_ADDR(csr_reg_addr + i)));
+        VTSS_RC(vtss_phy_wait_for_macsec_command_busy(vtss_state, port_no, 19)); // Wait for the write to complete
+    }
+
+    VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
+    return VTSS_RC_OK;
+}
+
 // See vtss_phy_csr_rd
 vtss_rc vtss_phy_macsec_csr_rd_private(vtss_state_t         *vtss_state,
                                        const vtss_port_no_t port_no,
@@ -9803,6 +10013,7 @@ vtss_rc vtss_phy_status_get_private(vtss_state_t *vtss_state,
     vtss_phy_reset_conf_t *conf = &ps->reset;
     revision = ps->type.revision;
 
+        ps->poll_cnt++;
         VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
         VTSS_N("vtss_phy_status_get_private, port_no: %u", port_no);
 
@@ -12149,6 +12360,12 @@ vtss_rc vtss_phy_pre_reset(const vtss_inst_t           inst,
     VTSS_ENTER();
     VTSS_D("Enter vtss_phy_pre_reset port_no:%d", port_no);
     if ((rc = vtss_inst_port_no_check(inst, &vtss_state, port_no)) == VTSS_RC_OK) {
+        // The PHYs may have been hardware reset
+        vtss_phy_page_cache_invalidate_all(vtss_state);
+#if defined(VTSS_OPT_PHY_TIMESTAMP)
+        vtss_phy_ts_csr_shadow_clear_all(vtss_state);
+#endif
+
         /* -- Step 1: Detect PHY type and family -- */
         rc = vtss_phy_detect(vtss_state, port_no);
 
@@ -13609,6 +13826,23 @@ vtss_rc vtss_phy_1g_debug_info_print(vtss_state_t *vtss_state,
                vtss_phy_chip_port(vtss_state, port_no)
               );
         }
+
+        /* MDIO accesses, e.g. compare MDIO/Poll before and after a number of polls */
+        pr("\nPort  MDIO Rd    MDIO Wr    Page Skip  Polls      MDIO/Poll  Page\n");
+        pr("----- ---------- ---------- ---------- ---------- ---------- ------\n");
+        for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
+            if (!info->port_list[port_no] || vtss_state->phy_state[port_no].type.part_number == VTSS_PHY_TYPE_NONE) {
+                continue;
+            }
+            ps = &vtss_state->phy_state[port_no];
+            pr("%-4u  %-10u %-10u %-10u %-10u %-10u ", port_no, ps->mdio_rd_cnt, ps->mdio_wr_cnt, ps->page_skip_cnt, ps->poll_cnt,
+               ps->poll_cnt ? (ps->mdio_rd_cnt + ps->mdio_wr_cnt) / ps->poll_cnt : 0);
+            if (ps->page_valid) {
+                pr("0x%04X\n", ps->page_cur);
+            } else {
+                pr("-\n");
+            }
+        }
     } else {
         /* Chip Interface Layer */
         for (port_no = VTSS_PORT_NO_START; port_no < vtss_state->port_count; port_no++) {
@@ -13660,6 +13894,7 @@ static void vtss_phy_deb_pr_reg (vtss_state_t *vtss_state, const vtss_debug_prin
         miim_write_fn(vtss_state, port_no, 31, page);
     }
     miim_read_fn(vtss_state, port_no, addr, value);
+    vtss_phy_page_cache_invalidate(vtss_state, port_no);
     pr("%-45s:  0x%02x   0x%04x     0x%08x\n", name, page, addr, *value);
 
 }
@@ -13873,6 +14108,28 @@ vtss_rc vtss_phy_do_page_chk_get(const vtss_inst_t          inst,
     return rc;
 }
 
+/* Set page_cache_verify */
+vtss_rc vtss_phy_page_cache_verify_set(const vtss_inst_t          inst,
+                                       const BOOL                 enable)
+{
+    vtss_rc rc = VTSS_RC_OK;
+    VTSS_ENTER();
+    vtss_phy_page_cache_verify_set_private(enable);
+    VTSS_EXIT();
+    return rc;
+}
+
+/* Get page_cache_verify */
+vtss_rc vtss_phy_page_cache_verify_get(const vtss_inst_t          inst,
+                                       BOOL                       *enable)
+{
+    vtss_rc rc = VTSS_RC_OK;
+    VTSS_ENTER();
+    vtss_phy_page_cache_verify_get_private(enable);
+    VTSS_EXIT();
+    return rc;
+}
+
 /* Get the current loopback */
 vtss_rc vtss_phy_loopback_get(const vtss_inst_t         inst,
                               const vtss_port_no_t      port_no,
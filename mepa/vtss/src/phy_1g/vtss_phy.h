@@ -82,6 +82,7 @@ typedef struct {
 
     BOOL  base_ports_found;        /* Used for internal in the PHY api to signal that base port is found for all ports. */
     BOOL  at_least_one_fiber_port; /* Signaling that at least at_one port in the system is a fiber port */
+    BOOL  page_bcast;              /* SMI broadcast writes enabled, page register cache can't be trusted */
 } vtss_phy_inst_state_t;
 
 /* Power configuration */
@@ -146,6 +147,16 @@ typedef struct _vtss_phy_port_state_info_t {
     BOOL                   warm_start_reg_changed;
     u16                    mac_block_mtu; /* MAC Block MTU  */
     u16                    forced_long_linkup_counter;    /* Delay for Forced Mode Work-Around for Forced Mode Long Linkup Time issue  */
+
+    // Page register cache, see vtss_phy_page_sel()
+    u16                    page_cur;      /* Page currently selected in register 31 */
+    BOOL                   page_valid;    /* page_cur reflects the chip */
+
+    // MDIO access counters, for debugging
+    u32                    mdio_rd_cnt;   /* MDIO reads */
+    u32                    mdio_wr_cnt;   /* MDIO writes */
+    u32                    page_skip_cnt; /* Page selects skipped due to the page register cache */
+    u32                    poll_cnt;      /* Status polls */
 } vtss_phy_port_state_t;
 
 #define MAX_REGISTERS_PER_PAGE  32
@@ -251,6 +262,9 @@ vtss_rc vtss_phy_wr_page(struct vtss_state_s *vtss_state,
 #define PHY_WR_MASKED_PAGE(vtss_state, port_no, page_addr, value, mask) vtss_phy_wr_masked_page(vtss_state, port_no, page_addr, value, mask, __LINE__)
 #define PHY_RD_PAGE(vtss_state, port_no, page_addr, value) vtss_phy_rd_page(vtss_state, port_no, page_addr, value, __LINE__)
 
+void vtss_phy_page_cache_invalidate(struct vtss_state_s *vtss_state, const vtss_port_no_t port_no);
+void vtss_phy_page_cache_invalidate_all(struct vtss_state_s *vtss_state);
+
 vtss_rc vtss_phy_page_std(struct vtss_state_s *vtss_state, vtss_port_no_t port_no);
 vtss_rc vtss_phy_page_ext(struct vtss_state_s *vtss_state, vtss_port_no_t port_no);
 vtss_rc vtss_phy_page_ext2(struct vtss_state_s *vtss_state, vtss_port_no_t port_no);
@@ -298,6 +312,14 @@ vtss_rc vtss_phy_macsec_csr_wr_private(struct vtss_state_s *vtss_state,
                                        const u32            csr_reg_addr,
                                        const u32            value);
 
+// Write 'cnt' consecutive CSRs of one target, selecting the MACsec page and target only once
+vtss_rc vtss_phy_macsec_csr_wr_inc_private(struct vtss_state_s  *vtss_state,
+                                           const vtss_port_no_t port_no,
+                                           const u16            target,
+                                           const u32            csr_reg_addr,
+                                           const u32            *value,
+                                           const u32            cnt);
+
 // Same as vtss_phy_1588_csr_rd defined in vtss_phy_api.h, but this function can be called within the API it-selves
 vtss_rc vtss_phy_macsec_csr_rd_private(struct vtss_state_s  *vtss_state,
                                        const vtss_port_no_t port_no,
@@ -69,6 +69,9 @@ vtss_rc vtss_phy_ts_bypass_set(vtss_state_t    *vtss_state,
                                BOOL force_bypass);
 
 
+/* Forget the shadowed analyzer CSRs, e.g. when the PHY may have been reset */
+void vtss_phy_ts_csr_shadow_clear_all(vtss_state_t *vtss_state);
+
 vtss_rc vtss_phy_ts_version_check(vtss_state_t    *vtss_state,
                                   const vtss_port_no_t port_no,
                                   BOOL *prevent);
@@ -963,32 +963,33 @@ static vtss_rc vtss_phy_ts_biu_address_map_get(
     return rc;
 }
 
-vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
-                             const vtss_port_no_t port_no,
-                             const vtss_phy_ts_blk_id_t blk_id,
-                             const u16 csr_address,
-                             u32 *const value)
+/* Resolve the PHY type, the access method and the port/block actually addressed by a CSR access */
+static vtss_rc vtss_phy_ts_csr_target_get(vtss_state_t *vtss_state,
+                                          const vtss_port_no_t port_no,
+                                          const vtss_phy_ts_blk_id_t blk_id,
+                                          u32 *const phy_type,
+                                          BOOL *const clause45,
+                                          BOOL *const spi_access,
+                                          vtss_phy_ts_biu_addr_map_t **biu_addr_map_ptr,
+                                          vtss_port_no_t *const cfg_port,
+                                          vtss_phy_ts_blk_id_t *const actual_blk_id)
 {
-    u32                        phy_type = 0;
     u16                        device_feature_status = 0;
-    BOOL                       clause45 = FALSE;
     vtss_phy_ts_oper_mode_t    oper_mode = VTSS_PHY_TS_OPER_MODE_INV;
-    vtss_port_no_t             cfg_port = port_no;
-    vtss_phy_ts_blk_id_t       actual_blk_id = 0;
-    vtss_phy_ts_biu_addr_map_t *biu_addr_map_ptr = NULL;
     vtss_port_no_t             base_port_no = 0;
-    BOOL                       spi_access = FALSE;
     BOOL                       gen = FALSE;
     BOOL                       support = FALSE;
 
+    *cfg_port = port_no;
+    *spi_access = FALSE;
     VTSS_RC(vtss_phy_ts_is_1588_supported(vtss_state, port_no, &gen, &support));
     if (gen) {
-        spi_access = vtss_state->init_conf.spi_32bit_read_write || vtss_state->init_conf.spi_read_write;
+        *spi_access = vtss_state->init_conf.spi_32bit_read_write || vtss_state->init_conf.spi_read_write;
     }
-    VTSS_RC(vtss_phy_ts_register_access_type_get(vtss_state, cfg_port, &phy_type, &device_feature_status,
-                                                 &clause45, &oper_mode));
-    VTSS_RC(vtss_phy_ts_biu_address_map_get(phy_type, &biu_addr_map_ptr));
-    actual_blk_id = blk_id;
+    VTSS_RC(vtss_phy_ts_register_access_type_get(vtss_state, port_no, phy_type, &device_feature_status,
+                                                 clause45, &oper_mode));
+    VTSS_RC(vtss_phy_ts_biu_address_map_get(*phy_type, biu_addr_map_ptr));
+    *actual_blk_id = blk_id;
     if (vtss_state->phy_ts_port_conf[port_no].port_ts_init_done != FALSE) {
         /* Function Access */
         /* Input Port (cfg_port) = 25, 26
@@ -998,22 +999,88 @@ vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
          *            Processor0
          */
 #ifdef VTSS_CHIP_10G_PHY
-        if(clause45 && (vtss_state->phy_10g_state[port_no].mode.alternate_port_ena) &&
+        if(*clause45 && (vtss_state->phy_10g_state[port_no].mode.alternate_port_ena) &&
                 (vtss_state->phy_10g_state[port_no].alt_port_no != port_no) && (vtss_state->phy_10g_state[port_no].family == VTSS_PHY_FAMILY_MALIBU)) {
             /* PHY is in cross connect mode , so use line port */
-            cfg_port = vtss_state->phy_10g_state[port_no].alt_port_no;
-            VTSS_RC(vtss_phy_ts_base_port_get_priv(vtss_state, cfg_port, &base_port_no));
+            *cfg_port = vtss_state->phy_10g_state[port_no].alt_port_no;
+            VTSS_RC(vtss_phy_ts_base_port_get_priv(vtss_state, *cfg_port, &base_port_no));
         } else
 
 #endif
-            base_port_no = vtss_state->phy_ts_port_conf[cfg_port].base_port;
-        if (base_port_no != cfg_port) {
-            cfg_port = base_port_no;
+            base_port_no = vtss_state->phy_ts_port_conf[*cfg_port].base_port;
+        if (base_port_no != *cfg_port) {
+            *cfg_port = base_port_no;
             if (blk_id == VTSS_PHY_TS_PROC_BLK_ID(0)) {
-                actual_blk_id = VTSS_PHY_TS_PROC_BLK_ID(1);
+                *actual_blk_id = VTSS_PHY_TS_PROC_BLK_ID(1);
             }
         }
     }
+    return VTSS_RC_OK;
+}
+
+/* - CSR shadow ---------------------------------------------------- */
+
+/* The analyzer blocks only hold configuration, which changes when the API writes it.
+ * Once a port is initialized these registers are shadowed on the base port, so that
+ * reads are served from memory and rewriting an unchanged value is skipped.
+ * The processor blocks (LTC, FIFO, counters and status) are always accessed on the PHY.
+ */
+#define VTSS_PHY_TS_CSR_SHADOW_KEY(blk_id, addr) ((u16)((((blk_id) << 11) | (addr)) + 1))
+#define VTSS_PHY_TS_CSR_SHADOW_IDX(blk_id, addr) (((addr) ^ ((blk_id) << 5)) & (VTSS_PHY_TS_CSR_SHADOW_SIZE - 1))
+
+static vtss_phy_ts_csr_shadow_t *vtss_phy_ts_csr_shadow_get(vtss_state_t *vtss_state,
+                                                            const vtss_port_no_t port_no,
+                                                            const vtss_port_no_t cfg_port,
+                                                            const vtss_phy_ts_blk_id_t blk_id,
+                                                            const u16 csr_address)
+{
+    if (blk_id >= VTSS_PHY_TS_PROC_BLK_ID(0) ||
+        vtss_state->phy_ts_port_conf[port_no].port_ts_init_done == FALSE) {
+        return NULL;
+    }
+    return &vtss_state->phy_ts_port_conf[cfg_port].csr_shadow[VTSS_PHY_TS_CSR_SHADOW_IDX(blk_id, csr_address)];
+}
+
+static void vtss_phy_ts_csr_shadow_clear(vtss_state_t *vtss_state, const vtss_port_no_t port_no)
+{
+    memset(vtss_state->phy_ts_port_conf[port_no].csr_shadow, 0,
+           sizeof(vtss_state->phy_ts_port_conf[port_no].csr_shadow));
+}
+
+void vtss_phy_ts_csr_shadow_clear_all(vtss_state_t *vtss_state)
+{
+    vtss_port_no_t port_no;
+
+    for (port_no = VTSS_PORT_NO_START; port_no < VTSS_PORT_NO_END; port_no++) {
+        if (vtss_state->phy_ts_port_conf[port_no].port_ts_init_done) {
+            vtss_phy_ts_csr_shadow_clear(vtss_state, vtss_state->phy_ts_port_conf[port_no].base_port);
+        }
+    }
+}
+
+vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
+                             const vtss_port_no_t port_no,
+                             const vtss_phy_ts_blk_id_t blk_id,
+                             const u16 csr_address,
+                             u32 *const value)
+{
+    u32                        phy_type = 0;
+    BOOL                       clause45 = FALSE;
+    vtss_port_no_t             cfg_port = port_no;
+    vtss_phy_ts_blk_id_t       actual_blk_id = 0;
+    vtss_phy_ts_biu_addr_map_t *biu_addr_map_ptr = NULL;
+    BOOL                       spi_access = FALSE;
+    vtss_phy_ts_csr_shadow_t   *shadow;
+
+    VTSS_RC(vtss_phy_ts_csr_target_get(vtss_state, port_no, blk_id, &phy_type, &clause45, &spi_access,
+                                       &biu_addr_map_ptr, &cfg_port, &actual_blk_id));
+    shadow = vtss_phy_ts_csr_shadow_get(vtss_state, port_no, cfg_port, actual_blk_id, csr_address);
+    if (shadow != NULL && shadow->key == VTSS_PHY_TS_CSR_SHADOW_KEY(actual_blk_id, csr_address) &&
+        !vtss_state->sync_calling_private) { /* Warm start sync compares with the chip */
+        vtss_state->phy_ts_port_conf[cfg_port].csr_rd_hit_cnt++;
+        *value = shadow->value;
+        return VTSS_RC_OK;
+    }
 
     switch (phy_type) {
 #ifdef VTSS_CHIP_10G_PHY
@@ -1152,7 +1219,7 @@ vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
 //            VTSS_D("Read CSR: port %u, blk_id %d, adr %x, value %x", port_no, blk_id, csr_address, *value);
         } else {
             /* 1588 - Page Selection */
-            VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_ADDR_EXT_REG, 0x1588));
+            VTSS_RC(vtss_phy_page_1588(vtss_state, cfg_port));
 
             reg_value = (VTSS_PHY_TS_1G_BIU_ADDR_REG_EXE_CMD  |
                          VTSS_PHY_TS_1G_BIU_ADDR_REG_READ_CMD |
@@ -1176,7 +1243,7 @@ vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
             VTSS_RC(miim_read_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_CSR_DATA_LOWER, &reg_value_lower));
             /* Restore standard page
              */
-            VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_ADDR_EXT_REG, VTSS_PHY_PAGE_STANDARD));
+            VTSS_RC(vtss_phy_page_std(vtss_state, cfg_port));
 
             *value = ((reg_value_upper << 16) | reg_value_lower);
 //            VTSS_D("Read CSR: port %u, blk_id %d, adr %x, value %x", port_no, blk_id, csr_address, *value);
@@ -1188,10 +1255,118 @@ vtss_rc vtss_phy_ts_read_csr(vtss_state_t *vtss_state,
         return VTSS_RC_ERROR;
     }
 
+    if (shadow != NULL) {
+        vtss_state->phy_ts_port_conf[cfg_port].csr_rd_miss_cnt++;
+        shadow->key = VTSS_PHY_TS_CSR_SHADOW_KEY(actual_blk_id, csr_address);
+        shadow->value = *value;
+    }
     VTSS_D("RD port %u, base port %u 1588 reg 0x%04x on block %u  = 0x%08x\n",port_no, cfg_port, csr_address, actual_blk_id, *value);
     return VTSS_RC_OK;
 }
 
+#define VTSS_PHY_TS_CSR_INC_MAX 8
+
+/* Read 'cnt' consecutive processor block CSRs in ascending address order.
+ * On the 1G PHYs the 1588 page is only selected once for the whole sequence and
+ * on the 10G PHYs all words are read with a single incrementing MMD read.
+ */
+static vtss_rc vtss_phy_ts_read_csr_inc(vtss_state_t *vtss_state,
+                                        const vtss_port_no_t port_no,
+                                        const vtss_phy_ts_blk_id_t blk_id,
+                                        const u16 csr_address,
+                                        u32 *const value,
+                                        const u16 cnt)
+{
+    u32                        phy_type = 0;
+    BOOL                       clause45 = FALSE;
+    vtss_port_no_t             cfg_port = port_no;
+    vtss_phy_ts_blk_id_t       actual_blk_id = 0;
+    vtss_phy_ts_biu_addr_map_t *biu_addr_map_ptr = NULL;
+    BOOL                       spi_access = FALSE;
+    u16                        i;
+
+    VTSS_RC(vtss_phy_ts_csr_target_get(vtss_state, port_no, blk_id, &phy_type, &clause45, &spi_access,
+                                       &biu_addr_map_ptr, &cfg_port, &actual_blk_id));
+    if (cnt > VTSS_PHY_TS_CSR_INC_MAX || spi_access) {
+        phy_type = 0; /* One CSR at a time */
+    }
+
+    switch (phy_type) {
+#ifdef VTSS_CHIP_10G_PHY
+    case VTSS_PHY_TYPE_8488:
+    case VTSS_PHY_TYPE_8489:
+    case VTSS_PHY_TYPE_8489_15:
+    case VTSS_PHY_TYPE_8490:
+    case VTSS_PHY_TYPE_8257:
+    case VTSS_PHY_TYPE_8254:
+    case VTSS_PHY_TYPE_8258: {
+        u16 reg_values[2 * VTSS_PHY_TS_CSR_INC_MAX];
+        u16 reg_addr;
+
+        if (!clause45) {
+            return VTSS_RC_ERROR;
+        }
+        /* Each CSR is two consecutive 16 bit MMD registers */
+        reg_addr = biu_addr_map_ptr->mdio_address[actual_blk_id] | (csr_address << 1);
+        VTSS_RC(vtss_state->init_conf.mmd_read_inc(vtss_state, cfg_port, biu_addr_map_ptr->mmd_addr, reg_addr,
+                                                   reg_values, (u8)(2 * cnt)));
+        for (i = 0; i < cnt; i++) {
+            value[i] = reg_values[2 * i] + (((u32)reg_values[2 * i + 1]) << 16);
+        }
+        return VTSS_RC_OK;
+    }
+#endif /* VTSS_CHIP_10G_PHY */
+#ifdef VTSS_CHIP_CU_PHY
+    case VTSS_PHY_TYPE_8574:
+    case VTSS_PHY_TYPE_8572:
+    case VTSS_PHY_TYPE_8575:
+    case VTSS_PHY_TYPE_8582:
+    case VTSS_PHY_TYPE_8584:
+    case VTSS_PHY_TYPE_8586: {
+        u16                reg_value;
+        u16                max_read;
+        u16                reg_value_upper, reg_value_lower;
+        vtss_miim_read_t   miim_read_func = vtss_state->init_conf.miim_read;
+        vtss_miim_write_t  miim_write_func = vtss_state->init_conf.miim_write;
+
+#ifdef VTSS_FEATURE_PTP_DELAY_COMP_ENGINE
+        if (vtss_state->phy_state[port_no].dce_port_init_done == TRUE &&
+            csr_address <= 0x18 && (csr_address + cnt) > 0x10) {
+            break;
+        }
+#endif /* VTSS_FEATURE_PTP_DELAY_COMP_ENGINE */
+        /* 1588 - Page Selection */
+        VTSS_RC(vtss_phy_page_1588(vtss_state, cfg_port));
+        for (i = 0; i < cnt; i++) {
+            reg_value = (VTSS_PHY_TS_1G_BIU_ADDR_REG_EXE_CMD  |
+                         VTSS_PHY_TS_1G_BIU_ADDR_REG_READ_CMD |
+                         (actual_blk_id << 11) | (csr_address + i));
+            VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_BIU_ADDR_REG, reg_value));
+            reg_value = 0;
+            max_read = 0;
+            do {
+                max_read++;
+                VTSS_RC(miim_read_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_BIU_ADDR_REG, &reg_value));
+            } while ((!(reg_value & VTSS_PHY_TS_1G_BIU_ADDR_REG_EXE_CMD)) && (max_read < VTSS_PHY_TS_1G_REG_READ_MAX_CNT));
+            VTSS_RC(miim_read_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_CSR_DATA_UPPER, &reg_value_upper));
+            VTSS_RC(miim_read_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_CSR_DATA_LOWER, &reg_value_lower));
+            value[i] = ((reg_value_upper << 16) | reg_value_lower);
+        }
+        /* Restore standard page */
+        VTSS_RC(vtss_phy_page_std(vtss_state, cfg_port));
+        return VTSS_RC_OK;
+    }
+#endif /* VTSS_CHIP_CU_PHY */
+    default:
+        break;
+    }
+
+    for (i = 0; i < cnt; i++) {
+        VTSS_RC(vtss_phy_ts_read_csr(vtss_state, port_no, blk_id, csr_address + i, &value[i]));
+    }
+    return VTSS_RC_OK;
+}
+
 vtss_rc vtss_phy_ts_write_csr(vtss_state_t *vtss_state,
                               const vtss_port_no_t port_no,
                               const vtss_phy_ts_blk_id_t blk_id,
@@ -1199,17 +1374,16 @@ vtss_rc vtss_phy_ts_write_csr(vtss_state_t *vtss_state,
                               const u32 *const value)
 {
     u32                        phy_type = 0;
-    u16                        device_feature_status = 0;
     BOOL                       clause45 = FALSE;
-    vtss_phy_ts_oper_mode_t    oper_mode = VTSS_PHY_TS_OPER_MODE_INV;
     vtss_port_no_t             cfg_port = port_no;
     vtss_phy_ts_blk_id_t       actual_blk_id = 0;
     vtss_phy_ts_biu_addr_map_t *biu_addr_map_ptr = NULL;
+#ifdef VTSS_CHIP_10G_PHY
     vtss_port_no_t             base_port_no = 0;
+#endif
     u32                        value32 = *value;
     BOOL                       spi_access = FALSE;
-    BOOL                       support = FALSE;
-    BOOL                       gen = FALSE;
+    vtss_phy_ts_csr_shadow_t   *shadow;
 
     VTSS_D("Write CSR: port %u, blk_id %d, adr %x, value %x", port_no, blk_id, csr_address, *value);
 
@@ -1219,39 +1393,19 @@ vtss_rc vtss_phy_ts_write_csr(vtss_state_t *vtss_state,
     reg_value_lower = (*value & 0xffff);
     reg_value_upper = (*value >> 16);
 #endif
-    VTSS_RC(vtss_phy_ts_is_1588_supported(vtss_state, port_no, &gen, &support));
-    if (gen) {
-        spi_access = vtss_state->init_conf.spi_32bit_read_write || vtss_state->init_conf.spi_read_write;
-    }
-
-    VTSS_RC(vtss_phy_ts_register_access_type_get(vtss_state, cfg_port, &phy_type, &device_feature_status,
-                                                 &clause45, &oper_mode));
-    VTSS_RC(vtss_phy_ts_biu_address_map_get(phy_type, &biu_addr_map_ptr));
-    actual_blk_id = blk_id;
-    if (vtss_state->phy_ts_port_conf[port_no].port_ts_init_done != FALSE) {
-        /* Function Access */
-        /* Input Port (cfg_port) = 25, 26
-         * Block Id = Ingress Engine0, Egress Engine0
-         *            Ingress Engine1, Egress Engine1
-         *            Ingress Engine2, Egress Engine2
-         *            Processor0
-         */
-#ifdef VTSS_CHIP_10G_PHY
-        if(clause45 && (vtss_state->phy_10g_state[port_no].mode.alternate_port_ena) &&
-                (vtss_state->phy_10g_state[port_no].alt_port_no != port_no) && (vtss_state->phy_10g_state[port_no].family == VTSS_PHY_FAMILY_MALIBU)) {
-            /* PHY is in cross connect mode , so use line port */
-            cfg_port = vtss_state->phy_10g_state[port_no].alt_port_no;
-            VTSS_RC(vtss_phy_ts_base_port_get_priv(vtss_state, cfg_port, &base_port_no));
-        } else
-#endif
-            base_port_no = vtss_state->phy_ts_port_conf[cfg_port].base_port;
-
-        if (base_port_no != cfg_port) {
-            cfg_port = base_port_no;
-            if (blk_id == VTSS_PHY_TS_PROC_BLK_ID(0)) {
-                actual_blk_id = VTSS_PHY_TS_PROC_BLK_ID(1);
-            }
+    VTSS_RC(vtss_phy_ts_csr_target_get(vtss_state, port_no, blk_id, &phy_type, &clause45, &spi_access,
+                                       &biu_addr_map_ptr, &cfg_port, &actual_blk_id));
+    shadow = vtss_phy_ts_csr_shadow_get(vtss_state, port_no, cfg_port, actual_blk_id, csr_address);
+    if (shadow != NULL) {
+        if (shadow->key == VTSS_PHY_TS_CSR_SHADOW_KEY(actual_blk_id, csr_address) && shadow->value == *value) {
+            vtss_state->phy_ts_port_conf[cfg_port].csr_wr_skip_cnt++;
+            return VTSS_RC_OK;
         }
+        /* Not known until the write has succeeded */
+        shadow->key = 0;
+    } else if (blk_id < VTSS_PHY_TS_PROC_BLK_ID(0)) {
+        /* Analyzer written before port init, possibly through another port of the 1588 block */
+        vtss_phy_ts_csr_shadow_clear_all(vtss_state);
     }
     VTSS_I("WR port %u, base port %u 1588 reg 0x%04x on block %u = 0x%08x\n",port_no, cfg_port, csr_address, actual_blk_id, *value);
 
@@ -1420,7 +1574,7 @@ vtss_rc vtss_phy_ts_write_csr(vtss_state_t *vtss_state,
             VTSS_RC(miim_read_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_CSR_DATA_UPPER, &base_reg_value));
 
             /* 1588 - Page Selection */
-            VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_ADDR_EXT_REG, 0x1588));
+            VTSS_RC(vtss_phy_page_1588(vtss_state, cfg_port));
 
             /* Write the upper word data (upper 16 bits) to register 18 */
             if ((blk_id == 6 || blk_id == 7) && (csr_address == 0x10 ||
@@ -1454,7 +1608,7 @@ vtss_rc vtss_phy_ts_write_csr(vtss_state_t *vtss_state,
             } while ((!(reg_value & VTSS_PHY_TS_1G_BIU_ADDR_REG_EXE_CMD)) && (max_read < VTSS_PHY_TS_1G_REG_READ_MAX_CNT));
 
             /* Restore standard page */
-            VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_ADDR_EXT_REG, VTSS_PHY_PAGE_STANDARD));
+            VTSS_RC(vtss_phy_page_std(vtss_state, cfg_port));
             if (base_reg_update != FALSE) {
                 VTSS_RC(miim_write_func(vtss_state, cfg_port, VTSS_PHY_TS_1G_CSR_DATA_UPPER, base_reg_value));
             }
@@ -1466,6 +1620,10 @@ vtss_rc vtss_phy_ts_write_csr(vtss_state_t *vtss_state,
         return VTSS_RC_ERROR;
     }
 
+    if (shadow != NULL) {
+        shadow->key = VTSS_PHY_TS_CSR_SHADOW_KEY(actual_blk_id, csr_address);
+        shadow->value = *value;
+    }
     return VTSS_RC_OK;
 }
 
@@ -1573,6 +1731,8 @@ vtss_rc vtss_phy_1588_csr_reg_read(const vtss_inst_t inst,
         }
 #endif
 
+        /* Debug access, always read the chip */
+        vtss_phy_ts_csr_shadow_clear(vtss_state, cfg_port);
         VTSS_PHY_TS_SPI_PAUSE(port_no);
         rc = VTSS_PHY_TS_READ_CSR(cfg_port, blk_id, csr_address, value);
         VTSS_PHY_TS_SPI_UNPAUSE(port_no);
@@ -1849,11 +2009,13 @@ static vtss_rc vtss_phy_ts_block_init(vtss_state_t *vtss_state, const vtss_port_
     case VTSS_PHY_TYPE_8586:
         /* initial setup of extended register 29 and 30 in 1588 extended page */
         /* 1588 - Page Selection */
-        VTSS_RC(vtss_state->init_conf.miim_write(vtss_state, base_port_no, VTSS_PHY_TS_1G_ADDR_EXT_REG, 0x1588));
+        VTSS_RC(vtss_phy_page_1588(vtss_state, base_port_no));
         /* Write the lower word data to register 29 */
-        VTSS_RC(vtss_state->init_conf.miim_write(vtss_state, base_port_no, 29, 0x7ae0));
+        VTSS_RC(vtss_phy_wr(vtss_state, base_port_no, 29, 0x7ae0));
         /* Write the upper word data to register 30 */
-        VTSS_RC(vtss_state->init_conf.miim_write(vtss_state, base_port_no, 30, 0xb71c));
+        VTSS_RC(vtss_phy_wr(vtss_state, base_port_no, 30, 0xb71c));
+        /* Restore standard page */
+        VTSS_RC(vtss_phy_page_std(vtss_state, base_port_no));
         break;
 #endif /* VTSS_CHIP_CU_PHY */
     default:
@@ -4325,6 +4487,7 @@ static vtss_rc vtss_phy_ts_fifo_empty_priv(const vtss_inst_t inst,
     vtss_phy_ts_fifo_sig_t      signature;
     vtss_phy_ts_fifo_status_t   status = VTSS_PHY_TS_FIFO_SUCCESS;
     u32   val_1st = 0, val_2nd = 0;
+    u32   fifo[6], i;
 
     vtss_phy_ts_fifo_read cb = NULL;
     void *cx = NULL;;
@@ -4370,18 +4533,8 @@ static vtss_rc vtss_phy_ts_fifo_empty_priv(const vtss_inst_t inst,
 
             if (VTSS_X_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_0_EGR_TS_FLAGS(value) != 7) {
                 /* Partial time stamps are invalid, empty the FIFO */
-                VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                             VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_1, &value));
-                VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                             VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_2, &value));
-                VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                             VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_3, &value));
-                VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                             VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_4, &value));
-                VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                             VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_5, &value));
-                VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                             VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_6, &value));
+                VTSS_RC(vtss_phy_ts_read_csr_inc(vtss_state, port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
+                                                 VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_1, fifo, 6));
                 break;
             }
             memset(&signature, 0, sizeof(vtss_phy_ts_fifo_sig_t));
@@ -4394,53 +4547,14 @@ static vtss_rc vtss_phy_ts_fifo_empty_priv(const vtss_inst_t inst,
             sig[0] = VTSS_X_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_0_EGR_TSFIFO_0(value) & 0xff;
             /* Step 3:: Read the TSFIFO_1 to TSFIFO_6 registers to get valid timestamp[207:16] data;
                         must always read the TSFIFO_6 register and it must be read last */
-            value = 0;
-            VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                         VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_1, &value));
-            sig[2] = VTSS_PHY_TS_EXTRACT_BYTE(value, 0);
-            sig[3] = VTSS_PHY_TS_EXTRACT_BYTE(value, 8);
-            sig[4] = VTSS_PHY_TS_EXTRACT_BYTE(value, 16);
-            sig[5] = VTSS_PHY_TS_EXTRACT_BYTE(value, 24);
-
-            value = 0;
-            VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                         VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_2, &value));
-            sig[6] = VTSS_PHY_TS_EXTRACT_BYTE(value, 0);
-            sig[7] = VTSS_PHY_TS_EXTRACT_BYTE(value, 8);
-            sig[8] = VTSS_PHY_TS_EXTRACT_BYTE(value, 16);
-            sig[9] = VTSS_PHY_TS_EXTRACT_BYTE(value, 24);
-
-            value = 0;
-            VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                         VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_3, &value));
-            sig[10] = VTSS_PHY_TS_EXTRACT_BYTE(value, 0);
-            sig[11] = VTSS_PHY_TS_EXTRACT_BYTE(value, 8);
-            sig[12] = VTSS_PHY_TS_EXTRACT_BYTE(value, 16);
-            sig[13] = VTSS_PHY_TS_EXTRACT_BYTE(value, 24);
-
-            value = 0;
-            VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                         VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_4, &value));
-            sig[14] = VTSS_PHY_TS_EXTRACT_BYTE(value, 0);
-            sig[15] = VTSS_PHY_TS_EXTRACT_BYTE(value, 8);
-            sig[16] = VTSS_PHY_TS_EXTRACT_BYTE(value, 16);
-            sig[17] = VTSS_PHY_TS_EXTRACT_BYTE(value, 24);
-
-            value = 0;
-            VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                         VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_5, &value));
-            sig[18] = VTSS_PHY_TS_EXTRACT_BYTE(value, 0);
-            sig[19] = VTSS_PHY_TS_EXTRACT_BYTE(value, 8);
-            sig[20] = VTSS_PHY_TS_EXTRACT_BYTE(value, 16);
-            sig[21] = VTSS_PHY_TS_EXTRACT_BYTE(value, 24);
-
-            value = 0;
-            VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
-                                         VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_6, &value));
-            sig[22] = VTSS_PHY_TS_EXTRACT_BYTE(value, 0);
-            sig[23] = VTSS_PHY_TS_EXTRACT_BYTE(value, 8);
-            sig[24] = VTSS_PHY_TS_EXTRACT_BYTE(value, 16);
-            sig[25] = VTSS_PHY_TS_EXTRACT_BYTE(value, 24);
+            VTSS_RC(vtss_phy_ts_read_csr_inc(vtss_state, port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
+                                             VTSS_PTP_EGR_IP_1588_TSFIFO_EGR_TSFIFO_1, fifo, 6));
+            for (i = 0; i < 6; i++) {
+                sig[2 + 4 * i] = VTSS_PHY_TS_EXTRACT_BYTE(fifo[i], 0);
+                sig[3 + 4 * i] = VTSS_PHY_TS_EXTRACT_BYTE(fifo[i], 8);
+                sig[4 + 4 * i] = VTSS_PHY_TS_EXTRACT_BYTE(fifo[i], 16);
+                sig[5 + 4 * i] = VTSS_PHY_TS_EXTRACT_BYTE(fifo[i], 24);
+            }
 
             /* Step 4:: Read the TSFIFO_CSR register and check the value of TS_FIFO_LEVEL */
             VTSS_RC(VTSS_PHY_TS_READ_CSR(port_no, VTSS_PHY_TS_PROC_BLK_ID(0),
@@ -15883,6 +15997,7 @@ vtss_rc vtss_phy_ts_init(const vtss_inst_t               inst,
             VTSS_E("Invalid clk_src selection, Please use correct clock source selection");
         }
 #endif
+        vtss_phy_ts_csr_shadow_clear(vtss_state, base_port_no);
         vtss_state->phy_ts_port_conf[port_no].port_ts_init_done = TRUE;
         vtss_state->phy_ts_port_conf[port_no].clk_freq      = conf->clk_freq;
         vtss_state->phy_ts_port_conf[port_no].clk_src       = conf->clk_src;
@@ -16130,6 +16245,7 @@ vtss_rc vtss_phy_dce_init(const vtss_inst_t inst,
 #endif /* VTSS_CHIP_CU_PHY */
 
         vtss_state->phy_ts_port_conf[port_no].base_port     = base_port_no;
+        vtss_phy_ts_csr_shadow_clear(vtss_state, base_port_no);
         vtss_state->phy_ts_port_conf[port_no].port_ts_init_done = TRUE;
 
         VTSS_PHY_TS_SPI_PAUSE_COLD(port_no);
@@ -16937,21 +17053,23 @@ static vtss_rc vtss_phy_ts_block_sync(
         /* initial setup of extended register 29 and 30 in 1588 extended page */
         /* 1588 - Page Selection */
 #ifdef VTSS_CHIP_CU_PHY
-        VTSS_RC(vtss_state->init_conf.miim_write(vtss_state, port_no, VTSS_PHY_TS_1G_ADDR_EXT_REG, 0x1588));
+        VTSS_RC(vtss_phy_page_1588(vtss_state, port_no));
         /* Read the lower word data from register 29
          */
-        VTSS_RC(vtss_state->init_conf.miim_read(vtss_state, port_no, 29, &reg_value_1));
+        VTSS_RC(vtss_phy_rd(vtss_state, port_no, 29, &reg_value_1));
         /* Read the upper word data from register 30
          */
-        VTSS_RC(vtss_state->init_conf.miim_read(vtss_state, port_no, 30, &reg_value_2));
+        VTSS_RC(vtss_phy_rd(vtss_state, port_no, 30, &reg_value_2));
         *block_sync = (((reg_value_1 == 0x7AE0) && (reg_value_2 == 0xB71C)) ? TRUE : FALSE);
         if (vtss_state->phy_ts_port_conf[port_no].port_ts_init_done != *block_sync) {
             reg_value_1 = (vtss_state->phy_ts_port_conf[port_no].port_ts_init_done) ? 0x7AE0 : 0;
-            VTSS_RC(vtss_state->init_conf.miim_write(vtss_state, port_no, 29, reg_value_1));
+            VTSS_RC(vtss_phy_wr(vtss_state, port_no, 29, reg_value_1));
             reg_value_2 = (vtss_state->phy_ts_port_conf[port_no].port_ts_init_done) ? 0xB71C : 0;
-            VTSS_RC(vtss_state->init_conf.miim_write(vtss_state, port_no, 30, reg_value_2));
+            VTSS_RC(vtss_phy_wr(vtss_state, port_no, 30, reg_value_2));
             /* TODO :: Need to Reset the 1G registers: disable mode for the port and the engines */
         }
+        /* Restore standard page */
+        VTSS_RC(vtss_phy_page_std(vtss_state, port_no));
 #endif
 #ifdef VTSS_CHIP_10G_PHY
     }
@@ -22241,6 +22359,7 @@ static void vtss_1588_api_dis_state(vtss_state_t *vtss_state, vtss_port_no_t por
     pr("rate_adj                              : %" PRIi64 "\n", vtss_state->phy_ts_port_conf[port_no].rate_adj);
     pr("event_mask                            : 0x%x\n", vtss_state->phy_ts_port_conf[port_no].event_mask);
     pr("event_enable                          : %s\n", vtss_state->phy_ts_port_conf[port_no].event_enable ? "TRUE" : "FALSE");
+    pr("csr shadow rd hit/miss, wr skip       : %u/%u, %u\n", pconf->csr_rd_hit_cnt, pconf->csr_rd_miss_cnt, pconf->csr_wr_skip_cnt);
 
     pr("\nIngress Engine Configuration\n");
     pr("-------------------------------------------------------\n");
@@ -22506,6 +22625,8 @@ void vtss_phy_ts_api_cil_debug_print(vtss_state_t *vtss_state,
             continue;
         }
         if (is_1588_capable_phy(vtss_state, port_no)) {
+            /* Dump the chip registers, not the shadow */
+            vtss_phy_ts_csr_shadow_clear_all(vtss_state);
             for (blk_id = 0; blk_id <= 7; blk_id++) {
                  if (info->full == TRUE) {
                      vtss_phy_1588_debug_reg_read_private(vtss_state, port_no, blk_id, pr);
@@ -34,6 +34,14 @@ static vtss_rc miim_write(vtss_state_t        *inst,
     return inst->callout[port_no]->miim_write(inst->callout_ctx[port_no], addr, value);
 }
 
+static vtss_rc miim_access_list(vtss_state_t            *inst,
+                                const vtss_port_no_t    port_no,
+                                const u32               cnt,
+                                vtss_phy_miim_access_t *const list)
+{
+    return mepa_miim_access_list_int(inst->callout[port_no], inst->callout_ctx[port_no], cnt, list);
+}
+
 static vtss_rc mmd_read(vtss_state_t        *inst,
                         const vtss_port_no_t port_no,
                         const u8             mmd,
@@ -141,6 +149,7 @@ static mepa_rc mscc_vtss_create(const mepa_callout_t    MEPA_SHARED_PTR *callout
         // callout outs.
         conf.miim_read = miim_read;
         conf.miim_write = miim_write;
+        conf.miim_access_list = miim_access_list;
         conf.mmd_read = mmd_read;
         conf.mmd_read_inc = mmd_read_inc;
         conf.mmd_write = mmd_write;
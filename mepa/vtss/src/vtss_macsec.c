@@ -308,6 +308,19 @@ static mepa_rc vtss_phy_macsec_tx_sa_activate(struct mepa_device *dev,
     return vtss_macsec_tx_sa_activate(data->vtss_instance, port, an);
 }
 
+static mepa_rc vtss_phy_macsec_sa_rollover(struct mepa_device *dev,
+                                           const mepa_macsec_port_t port,
+                                           const uint16_t an,
+                                           const uint32_t next_pn,
+                                           const uint32_t lowest_pn,
+                                           const mepa_bool_t confidentiality,
+                                           const mepa_macsec_sak_t *const sak,
+                                           const mepa_bool_t activate)
+{
+    phy_data_t *data = (phy_data_t *)dev->data;
+    return vtss_macsec_sa_rollover(data->vtss_instance, port, an, next_pn, lowest_pn, confidentiality, sak, activate);
+}
+
 static mepa_rc vtss_phy_macsec_tx_sa_disable(struct mepa_device *dev,
                                              const mepa_macsec_port_t port,
                                              const uint16_t an)
@@ -976,5 +989,6 @@ mepa_macsec_driver_t vtss_macsec_drivers = {
     .mepa_macsec_dbg_reconfig = vtss_phy_macsec_dbg_reconfig,
 #endif
     .mepa_macsec_dbg_update_seq_set = vtss_phy_macsec_dbg_update_seq_set,
+    .mepa_macsec_sa_rollover = vtss_phy_macsec_sa_rollover,
 
 };
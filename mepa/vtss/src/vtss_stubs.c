@@ -174,6 +174,11 @@ vtss_rc vtss_macsec_tx_sa_activate(const vtss_inst_t inst, const vtss_macsec_por
     return VTSS_RC_NOT_IMPLEMENTED;
 }
 
+vtss_rc vtss_macsec_sa_rollover(const vtss_inst_t inst, const vtss_macsec_port_t port, const u16 an, const u32 next_pn, const u32 lowest_pn, const BOOL confidentiality, const vtss_macsec_sak_t *const sak, const BOOL activate)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
 vtss_rc vtss_macsec_tx_sa_disable(const vtss_inst_t inst, const vtss_macsec_port_t port, const u16 an)
 {
     return VTSS_RC_NOT_IMPLEMENTED;
@@ -1273,6 +1278,16 @@ vtss_rc vtss_phy_do_page_chk_get(const vtss_inst_t inst, BOOL *enable)
     return VTSS_RC_NOT_IMPLEMENTED;
 }
 
+vtss_rc vtss_phy_page_cache_verify_set(const vtss_inst_t inst, const BOOL enable)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
+vtss_rc vtss_phy_page_cache_verify_get(const vtss_inst_t inst, BOOL *enable)
+{
+    return VTSS_RC_NOT_IMPLEMENTED;
+}
+
 vtss_rc vtss_phy_loopback_set(const vtss_inst_t inst, const vtss_port_no_t port_no, vtss_phy_loopback_t loopback)
 {
     return VTSS_RC_NOT_IMPLEMENTED;
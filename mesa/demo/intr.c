@@ -245,7 +245,7 @@ static void intr_init(void)
     setlinebuf(irq_wr);
 
     // Register for activity on UIO file descriptor
-    fd_read_register(uio_fd, intr_callback, NULL);
+    fd_read_register_prio(uio_fd, intr_callback, NULL, FD_READ_PRIO_HIGH);
 
     (void)MEBA_WRAP(meba_reset, meba_global_inst, MEBA_INTERRUPT_INITIALIZE);
 
@@ -8,6 +8,8 @@
 #include <sys/socket.h>
 #include <errno.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/uio.h>
 #include "microchip/ethernet/switch/api.h"
 #include "microchip/ethernet/board/api.h"
 #include <mesa-rpc.h>
@@ -1470,6 +1472,62 @@ static mesa_rc mesa_rpc_meba_phy_ts_fifo_read_install(json_rpc_req_t *req)
 }
 
 
+// Counters for all ports in one reply, to avoid a request per port when scraping
+static mesa_rc port_counters_get_all(json_rpc_req_t *req)
+{
+    mesa_port_no_t       port_no;
+    mesa_port_counters_t counters;
+    json_object          *obj;
+
+    MESA_RC(json_rpc_array_new(req, &obj));
+    MESA_RC(json_rpc_add_json_array(req, req->result, obj));
+    for (port_no = 0; port_no < mesa_port_cnt(NULL); port_no++) {
+        MESA_RC(json_rpc_call(req, mesa_port_counters_get(NULL, port_no, &counters)));
+        MESA_RC(json_rpc_add_mesa_port_counters_t(req, obj, &counters));
+    }
+    return MESA_RC_OK;
+}
+
+static mesa_rc port_status_get_all(json_rpc_req_t *req)
+{
+    mesa_port_no_t     port_no;
+    mesa_port_status_t status;
+    json_object        *obj;
+
+    MESA_RC(json_rpc_array_new(req, &obj));
+    MESA_RC(json_rpc_add_json_array(req, req->result, obj));
+    for (port_no = 0; port_no < mesa_port_cnt(NULL); port_no++) {
+        MESA_RC(json_rpc_call(req, mscc_appl_port_status_get(port_no, &status)));
+        MESA_RC(json_rpc_add_mesa_port_status_t(req, obj, &status));
+    }
+    return MESA_RC_OK;
+}
+
+#define MAC_TABLE_PAGE_MAX 1024
+
+// Up to 'cnt' MAC table entries following 'vid_mac'. The next page starts after the last entry returned.
+static mesa_rc mac_table_get_page(json_rpc_req_t *req)
+{
+    mesa_mac_table_entry_t entry;
+    uint32_t               cnt, i;
+    json_object            *obj;
+
+    memset(&entry, 0, sizeof(entry));
+    MESA_RC(json_rpc_get_idx_mesa_vid_mac_t(req, req->params, &req->idx, &entry.vid_mac));
+    MESA_RC(json_rpc_get_idx_uint32_t(req, req->params, &req->idx, &cnt));
+    if (cnt > MAC_TABLE_PAGE_MAX) {
+        cnt = MAC_TABLE_PAGE_MAX;
+    }
+    MESA_RC(json_rpc_add_json_null(req, req->result));
+    MESA_RC(json_rpc_add_json_null(req, req->result));
+    MESA_RC(json_rpc_array_new(req, &obj));
+    MESA_RC(json_rpc_add_json_array(req, req->result, obj));
+    for (i = 0; i < cnt && mesa_mac_table_get_next(NULL, &entry.vid_mac, &entry) == MESA_RC_OK; i++) {
+        MESA_RC(json_rpc_add_mesa_mac_table_entry_t(req, obj, &entry));
+    }
+    return MESA_RC_OK;
+}
+
 static json_rpc_method_t json_rpc_static_table[] = {
     { "mesa_qos_dscp_dpl_conf_get", mesa_rpc_mesa_qos_dscp_dpl_conf_get },
     { "mesa_qos_dscp_dpl_conf_set", mesa_rpc_mesa_qos_dscp_dpl_conf_set },
@@ -1481,6 +1539,9 @@ static json_rpc_method_t json_rpc_static_table[] = {
     { "mesa_misc_get", misc_get },
     { "mesa_packet_tx_frame", mesa_rpc_packet_tx_frame },
     { "mesa_event_get", event_get },
+    { "mscc_appl_port_counters_get_all", port_counters_get_all },
+    { "mscc_appl_port_status_get_all", port_status_get_all },
+    { "mscc_appl_mac_table_get_page", mac_table_get_page },
     { NULL, NULL}
 };
 
@@ -1493,10 +1554,74 @@ static json_rpc_method_t json_rpc_phy_static_table[] = {
 
 /* - JSON-RPC parser ----------------------------------------------- */
 
+// All methods sorted by name, built once at init and searched with bsearch().
+typedef struct {
+    const json_rpc_method_t *method;
+    int                     order; // Table precedence for duplicate names
+} json_rpc_idx_t;
+
+static json_rpc_idx_t *json_rpc_idx;
+static int            json_rpc_idx_cnt;
+
+static int json_rpc_idx_cmp(const void *a, const void *b)
+{
+    const json_rpc_idx_t *x = a, *y = b;
+    int                  rc = strcmp(x->method->name, y->method->name);
+
+    return (rc ? rc : (x->order - y->order));
+}
+
+static int json_rpc_idx_key_cmp(const void *key, const void *b)
+{
+    return strcmp((const char *)key, ((const json_rpc_idx_t *)b)->method->name);
+}
+
+static void json_rpc_idx_build(void)
+{
+    json_rpc_method_t *table[] = { json_rpc_table, json_rpc_static_table, json_rpc_phy_static_table };
+    json_rpc_method_t *method;
+    int               i, cnt = 0, j = 0;
+
+    for (i = 0; i < sizeof(table)/sizeof(table[0]); i++) {
+        for (method = table[i]; method->cb != NULL; method++) {
+            cnt++;
+        }
+    }
+    if ((json_rpc_idx = malloc(cnt * sizeof(*json_rpc_idx))) == NULL) {
+        T_E("method index malloc failed, using linear lookup");
+        return;
+    }
+    for (i = 0; i < sizeof(table)/sizeof(table[0]); i++) {
+        for (method = table[i]; method->cb != NULL; method++, j++) {
+            json_rpc_idx[j].method = method;
+            json_rpc_idx[j].order = j;
+        }
+    }
+    qsort(json_rpc_idx, cnt, sizeof(*json_rpc_idx), json_rpc_idx_cmp);
+
+    // Keep only the first table's entry when a name is defined more than once
+    for (i = 0, j = 0; i < cnt; i++) {
+        if (j == 0 || strcmp(json_rpc_idx[j - 1].method->name, json_rpc_idx[i].method->name)) {
+            json_rpc_idx[j++] = json_rpc_idx[i];
+        }
+    }
+    json_rpc_idx_cnt = j;
+    T_I("indexed %d methods", j);
+}
+
 static int find_and_call_method(const char *method_name, json_rpc_req_t *req)
 {
     int                 found = 0;
     json_rpc_method_t   *method;
+    json_rpc_idx_t      *idx;
+
+    if (json_rpc_idx != NULL) {
+        if ((idx = bsearch(method_name, json_rpc_idx, json_rpc_idx_cnt, sizeof(*idx), json_rpc_idx_key_cmp)) != NULL) {
+            idx->method->cb(req);
+            return 1;
+        }
+        return 0;
+    }
 
     for (method = json_rpc_table; method->cb != NULL && !found; method++) {
         if (!strcmp(method->name, method_name)) {
@@ -1603,23 +1728,18 @@ static cli_cmd_t cli_cmd_table[] = {
     },
 };
 
-static int json_rpc_parse(int fd, char *msg)
+// Handle one request object and return its reply object, or NULL if the request is malformed
+static json_object *json_rpc_handle(json_object *obj_req)
 {
-    json_object       *obj_req, *obj_rep, *obj_result, *obj_error, *obj_method, *obj_id;
-    const char        *method_name, *reply;
+    json_object       *obj_rep = NULL, *obj_result, *obj_error, *obj_method, *obj_id;
+    const char        *method_name;
     json_rpc_req_t    req = {};
-    int               send_reply = 0, found = 0;
-    uint32_t          len, *p;
-    char              hdr[JSON_RPC_HDR_LEN];
-
-    T_N("request: %s", msg);
+    int               found = 0;
 
     req.idx = 0;
     req.result = NULL;
     sprintf(req.buf, "internal error");
-    if ((obj_req = json_tokener_parse(msg)) == NULL) {
-        T_I("json_tokener_parse failed");
-    } else if (!json_object_object_get_ex(obj_req, "method", &obj_method)) {
+    if (!json_object_object_get_ex(obj_req, "method", &obj_method)) {
         T_I("method object not found");
     } else if (json_object_get_type(obj_method) != json_type_string) {
         T_I("method object not string");
@@ -1631,9 +1751,10 @@ static int json_rpc_parse(int fd, char *msg)
         T_I("id object not found");
     } else if ((req.result = json_object_new_array()) == NULL) {
         T_I("alloc reply object failed");
+    } else if ((obj_rep = json_object_new_object()) == NULL) {
+        T_I("alloc reply object failed");
     } else {
         // Lookup and call method
-        send_reply = 1;
         method_name = json_object_get_string(obj_method);
         req.ptr = req.buf;
         req.ptr += sprintf(req.ptr, "method '%s': ", method_name);
@@ -1644,9 +1765,6 @@ static int json_rpc_parse(int fd, char *msg)
             sprintf(req.ptr, "not found");
             req.error = 1;
         }
-    }
-    
-    if (send_reply && (obj_rep = json_object_new_object()) != NULL) {
         if (req.error) {
             obj_result = NULL;
             obj_error = json_object_new_string(req.buf);
@@ -1658,36 +1776,86 @@ static int json_rpc_parse(int fd, char *msg)
         json_object_object_add(obj_rep, "result", obj_result);
         json_object_object_add(obj_rep, "error", obj_error);
         json_object_object_add(obj_rep, "id", json_object_get(obj_id));
+    }
+
+    // Free objects (the call ignores NULL object)
+    json_object_put(req.result);
+
+    return obj_rep;
+}
+
+// Parse and handle one message, which is either a single request object or a batch array of
+// requests. A batch is answered with one array holding the replies in request order.
+// The tokener is owned by the session and reset per message.
+static int json_rpc_parse(int fd, json_tokener *tok, const char *msg, uint32_t msg_len)
+{
+    json_object       *obj_req, *obj_rep = NULL, *obj;
+    const char        *reply;
+    uint32_t          len;
+    size_t            i, cnt;
+    char              hdr[JSON_RPC_HDR_LEN];
+    struct iovec      iov[2];
+
+    T_N("request: %.*s", (int)msg_len, msg);
+
+    json_tokener_reset(tok);
+    if ((obj_req = json_tokener_parse_ex(tok, msg, msg_len)) == NULL) {
+        T_I("json_tokener_parse_ex failed: %s", json_tokener_error_desc(json_tokener_get_error(tok)));
+    } else if (json_object_get_type(obj_req) != json_type_array) {
+        obj_rep = json_rpc_handle(obj_req);
+    } else if ((cnt = json_object_array_length(obj_req)) == 0) {
+        T_I("empty batch");
+    } else if ((obj_rep = json_object_new_array()) == NULL) {
+        T_I("alloc batch reply failed");
+    } else {
+        for (i = 0; i < cnt; i++) {
+            if ((obj = json_rpc_handle(json_object_array_get_idx(obj_req, i))) != NULL) {
+                json_object_array_add(obj_rep, obj);
+            }
+        }
+        if (json_object_array_length(obj_rep) == 0) {
+            json_object_put(obj_rep);
+            obj_rep = NULL;
+        }
+    }
+
+    if (obj_rep != NULL) {
         reply = json_object_to_json_string(obj_rep);
         len = strlen(reply);
-        p = (uint32_t *)hdr;
-        *p = htonl(len);
+        *(uint32_t *)hdr = htonl(len);
         T_I("reply length: %u", len);
         T_D("reply: %s", reply);
-        if (write(fd, hdr, sizeof(hdr)) != sizeof(hdr) || 
-            write(fd, reply, len) != len) {
+        // Header and body in one segment, so pipelined clients are not held back by Nagle
+        iov[0].iov_base = hdr;
+        iov[0].iov_len = sizeof(hdr);
+        iov[1].iov_base = (void *)reply;
+        iov[1].iov_len = len;
+        if (writev(fd, iov, 2) != (sizeof(hdr) + len)) {
             T_E("write error");
         }
         json_object_put(obj_rep);
     }
 
-    // Free objects (the call ignores NULL object)
     json_object_put(obj_req);
-    json_object_put(req.result);
 
     return 0;
 }
 
+// A session keeps its receive buffer and tokener for its lifetime. Any number of requests
+// may be queued by the client; complete ones are handled in arrival order on each read.
 typedef struct {
     int                fd;
     struct sockaddr_in addr;
-    uint32_t           len;
-    uint32_t           rx_cnt;
-    char               *msg;
+    char               *buf;  // Receive buffer
+    uint32_t           size;  // Allocated size of buf
+    uint32_t           cnt;   // Bytes received, not yet handled
+    json_tokener       *tok;
 } json_rpc_con_t;
 
 #define FD_FREE (-1)
-#define JSON_RPC_CON_MAX 4
+#define JSON_RPC_CON_MAX  8
+#define JSON_RPC_MSG_MAX  (100 * 1024)
+#define JSON_RPC_RX_CHUNK 4096
 static json_rpc_con_t json_rpc_con_table[JSON_RPC_CON_MAX];
 
 static json_rpc_con_t *json_rpc_connection_lookup(int fd)
@@ -1704,81 +1872,112 @@ static json_rpc_con_t *json_rpc_connection_lookup(int fd)
     return NULL;
 }
 
+static void json_rpc_connection_close(json_rpc_con_t *con)
+{
+    T_I("closing connection");
+    if (fd_read_register(con->fd, NULL, NULL)) {
+        T_E("Failed to un-rgister fd");
+    }
+    close(con->fd);
+    free(con->buf);
+    if (con->tok) {
+        json_tokener_free(con->tok);
+    }
+    memset(con, 0, sizeof(*con));
+    con->fd = FD_FREE;
+}
+
+// Make room for at least 'size' bytes in the receive buffer
+static int json_rpc_buf_reserve(json_rpc_con_t *con, uint32_t size)
+{
+    char *buf;
+
+    if (size <= con->size) {
+        return 0;
+    }
+    if ((buf = (char *)realloc(con->buf, size)) == NULL) {
+        T_E("msg realloc failed");
+        return -1;
+    }
+    con->buf = buf;
+    con->size = size;
+    return 0;
+}
+
 static void json_rpc_connection(int fd, void *ref)
 {
-    int            n, error = 1;
-    uint32_t       len;
-    json_rpc_con_t *con;
-    char           hdr[JSON_RPC_HDR_LEN], *p = hdr;
+    int            n;
+    uint32_t       len, done = 0;
+    json_rpc_con_t *con = ref;
 
-    // Lookup connection
-    if ((con = json_rpc_connection_lookup(fd)) == NULL) {
+    if (con == NULL || con->fd != fd) {
         T_E("connection not found");
         return;
     }
 
-    if (con->len == 0) {
-        // Read header
-        if ((n = read(fd, hdr, sizeof(hdr))) < sizeof(hdr)) {
-            T_I("header small");
-        } else if ((len = ntohl(*(uint32_t *)p)) == 0 || len > (100 * 1024)) {
+    if (json_rpc_buf_reserve(con, con->cnt + JSON_RPC_RX_CHUNK) < 0) {
+        json_rpc_connection_close(con);
+        return;
+    }
+    if ((n = read(fd, con->buf + con->cnt, con->size - con->cnt)) <= 0) {
+        T_I("no data");
+        json_rpc_connection_close(con);
+        return;
+    }
+    con->cnt += n;
+
+    // Handle all complete messages: 4 bytes length field followed by data
+    while (con->cnt - done >= JSON_RPC_HDR_LEN) {
+        len = ntohl(*(uint32_t *)(con->buf + done));
+        if (len == 0 || len > JSON_RPC_MSG_MAX) {
             T_E("illegal length: %u", len);
-        } else if ((con->msg = (char *)malloc(len + 1)) == NULL) {
-            T_E("msg malloc failed");
-        } else {
-            T_I("data length: %u", len);
-            con->len = len;
+            json_rpc_connection_close(con);
             return;
         }
-    } else if ((n = read(fd, con->msg + con->rx_cnt, con->len - con->rx_cnt)) <= 0) {
-        // Read data failed
-        T_I("no data");
-    } else {
-        // Read data success
-        error = 0;
-        con->rx_cnt += n;
-        if (con->rx_cnt != con->len) {
-            // Message not complete
-            return;
+        if (con->cnt - done < JSON_RPC_HDR_LEN + len) {
+            // Message not complete, make sure the rest fits
+            if (json_rpc_buf_reserve(con, JSON_RPC_HDR_LEN + len) < 0) {
+                json_rpc_connection_close(con);
+                return;
+            }
+            break;
         }
-        con->msg[con->len] = 0;
-        error = json_rpc_parse(fd, con->msg);
-    }
-
-    // Free message
-    if (con->msg) {
-        free(con->msg);
+        T_I("data length: %u", len);
+        (void)json_rpc_parse(fd, con->tok, con->buf + done + JSON_RPC_HDR_LEN, len);
+        done += (JSON_RPC_HDR_LEN + len);
     }
-    memset(con, 0, sizeof(*con));
-
-    if (error) {
-        T_I("closing connection");
-        close(fd);
-        if (fd_read_register(fd, NULL, NULL)) {
-            T_E("Failed to un-rgister fd");
-        }
-        con->fd = FD_FREE;
-    } else {
-        // Preserve file descriptor
-        con->fd = fd;
+    if (done) {
+        con->cnt -= done;
+        memmove(con->buf, con->buf + done, con->cnt);
     }
 }
 
 static void json_rpc_accept(int fd, void *ref)
 {
-    json_rpc_con_t *con;
-    socklen_t      len = sizeof(con->addr);
-    
-    // Lookup free connection
-    if ((con = json_rpc_connection_lookup(FD_FREE)) == NULL) {
-        T_E("no free connection");
-    } else if ((fd = accept(fd, (struct sockaddr *)&con->addr, &len)) < 0) {
+    json_rpc_con_t     *con;
+    struct sockaddr_in addr;
+    socklen_t          len = sizeof(addr);
+    int                one = 1;
+
+    if ((fd = accept(fd, (struct sockaddr *)&addr, &len)) < 0) {
         T_E("accept() failed: %s", strerror(errno));
-    } else if (fd_read_register(fd, json_rpc_connection, NULL) < 0) {
+    } else if ((con = json_rpc_connection_lookup(FD_FREE)) == NULL) {
+        // Refuse it, leaving it in the backlog would wake us up again and again
+        T_E("no free connection");
+        close(fd);
+    } else if ((con->tok = json_tokener_new()) == NULL) {
+        T_E("json_tokener_new() failed");
+        close(fd);
+    } else if (fd_read_register(fd, json_rpc_connection, con) < 0) {
         T_E("fd_read_register() failed");
+        json_tokener_free(con->tok);
+        con->tok = NULL;
+        close(fd);
     } else {
         T_N("new connection accepted");
+        (void)setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
         con->fd = fd;
+        con->addr = addr;
     }
 }
 
@@ -1800,7 +1999,7 @@ static void json_rpc_init(void)
     } else if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
         T_E("bind failed: %s", strerror(errno));
         close(fd);
-    } else if (listen(fd, 1) < 0) {
+    } else if (listen(fd, JSON_RPC_CON_MAX) < 0) {
         T_E("listen failed: %s", strerror(errno));
         close(fd);
     } else if (fd_read_register(fd, json_rpc_accept, NULL) < 0) {
@@ -1820,6 +2019,7 @@ void mscc_appl_json_rpc_init(mscc_appl_init_t *init)
         break;
 
     case MSCC_INIT_CMD_INIT:
+        json_rpc_idx_build();
         json_rpc_init();
 
         for (i = 0; i < sizeof(cli_cmd_table)/sizeof(cli_cmd_t); i++) {
@@ -914,6 +914,7 @@ static void cli_cmd_port_kr_status(cli_req_t *req)
         cli_printf("  R-FEC (CL-74)     : %s\n",sts.fec.r_fec_enable ? "Enabled":"Disabled");
         cli_printf("  RS-FEC (CL-108)   : %s\n",sts.fec.rs_fec_enable ? "Enabled":"Disabled");
         cli_printf("  Time since start  : %d sec\n",get_time_sec(&appl->time_start_aneg));
+        cli_printf("  Time to link      : %d ms\n",appl->time_link);
         if (!kr.train.enable) {
             cli_printf("  Training          : Disabled\n");
         } else {
@@ -1102,13 +1103,12 @@ static void dump_irq(u32 p, u32 irq, u32 time, u32 irqs)
     }
 }
 
-static void kr_poll_v3(meba_inst_t inst, mesa_port_no_t iport)
+static void kr_poll_v3(meba_inst_t inst, mesa_port_no_t iport, uint32_t irq)
 {
     mesa_port_no_t        uport;
     mesa_port_kr_conf_t   kr_conf;
     mesa_port_conf_t      pconf;
     mesa_port_kr_state_t  *krs;
-    uint32_t              irq;
     kr_appl_train_t       *kr;
     mesa_port_kr_status_t status;
     mesa_port_kr_fec_t fec = {0};
@@ -1125,10 +1125,6 @@ static void kr_poll_v3(meba_inst_t inst, mesa_port_no_t iport)
     uport = iport2uport(iport);
     kr = &kr_conf_state[iport].tr;
     krs = &kr->state;
-    // Poll the IRQs
-    if (mesa_port_kr_irq_get(NULL, iport, &irq) != MESA_RC_OK) {
-        printf("-->Failure during mesa_port_kr_irq_get\n");
-    }
 
     if (mesa_port_kr_status_get(NULL, iport, &status) != MESA_RC_OK) {
         printf("-->Failure during port_kr_status_get\n");
@@ -1260,6 +1256,7 @@ static void kr_poll_v3(meba_inst_t inst, mesa_port_no_t iport)
     // Aneg completed
     if (irq & MESA_KR_AN_GOOD) {
         mesa_port_state_set(NULL, iport, TRUE);
+        kr->time_link = get_time_ms(&kr->time_start_aneg);
         if (krs->current_state == MESA_TR_SEND_DATA) {
             mesa_port_kr_eye_dim_t  eye;
             (void)mesa_port_kr_eye_get(NULL, iport, &eye);
@@ -1301,20 +1298,45 @@ static void kr_poll(meba_inst_t inst)
     uint16_t meba_cnt = inst->api.meba_capability(inst, MEBA_CAP_BOARD_PORT_COUNT);
 
     if (BASE_KR_V3) {
+        mesa_port_no_t      port_list[meba_cnt];
+        uint32_t            irq_list[meba_cnt], i, cnt = 0, n;
+        mesa_port_kr_conf_t kr_conf;
+
         for (iport = 0; iport < meba_cnt; iport++) {
             if (!kr_conf_state[iport].aneg_enable) {
                 continue;
             }
+            // The IRQs are cleared when read, so only ports in KR aneg must be included
+            if (mesa_port_kr_conf_get(NULL, iport, &kr_conf) != MESA_RC_OK || !kr_conf.aneg.enable) {
+                continue;
+            }
             if (mesa_port_conf_get(NULL, iport, &pconf) == MESA_RC_OK && pconf.power_down) {
                 continue;
             }
+            // For debugging..
+            if (kr_conf_state[iport].global_stop && kr_conf_state[iport].link_break) {
+                continue;
+            }
             if (kr_conf_state[iport].pollcnt == 0) {
                 kr_conf_state[iport].pollcnt = 1;
             }
-            while (kr_conf_state[iport].pollcnt > 0) { // When the training starts then the IRQs comes fast
-                kr_poll_v3(inst, iport);
-                kr_conf_state[iport].pollcnt--;
+            port_list[cnt++] = iport;
+        }
+
+        // Poll the IRQs of all ports in one pass and progress the training of all ports
+        // in each round, so ports in training do not wait for each other.
+        while (cnt > 0) { // When the training starts then the IRQs comes fast
+            if (mesa_port_kr_irq_list_get(NULL, cnt, port_list, irq_list) != MESA_RC_OK) {
+                printf("-->Failure during mesa_port_kr_irq_list_get\n");
+            }
+            for (i = 0, n = 0; i < cnt; i++) {
+                iport = port_list[i];
+                kr_poll_v3(inst, iport, irq_list[i]);
+                if (--kr_conf_state[iport].pollcnt > 0) {
+                    port_list[n++] = iport;
+                }
             }
+            cnt = n;
         }
     } else if (BASE_KR_V2) {
         for (iport = 0; iport < meba_cnt; iport++) {
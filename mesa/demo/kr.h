@@ -77,6 +77,7 @@ typedef struct {
     struct timeval time_start_aneg;
     struct timeval time_start_train;
     uint32_t time_ld;
+    uint32_t time_link;
     uint32_t time_lp;
     uint32_t time_since_restart;
     mesa_port_kr_status_t status;
@@ -3,6 +3,8 @@
 
 
 #include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
 #include <dirent.h>
 #include <fcntl.h>
 #include <errno.h>
@@ -12,8 +14,10 @@
 #include <sys/ioctl.h>
 #include <sys/mman.h>
 #include <sys/socket.h>
-#include <sys/select.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
 #include <sys/syscall.h>
+#include <time.h>
 
 #include "microchip/ethernet/switch/api.h"
 #include "microchip/ethernet/board/api.h"
@@ -25,12 +29,19 @@
 #define ARRSZ(_x_)  (sizeof(_x_) / sizeof((_x_)[0]))
 
 #define I2C_PORT2DEV(p) (100 + p)
+#define I2C_FD_CNT      128 // Ports with a persistent I2C adapter file descriptor
 
 // Local data
 static int LOOP_PORT = -1;
 static int REF_BOARD_PCB = -1;
 static int REF_BOARD_PORT_COUNT = -1;
 
+// I2C adapters are kept open between transactions
+static struct {
+    mesa_bool_t open;
+    int         fd;
+} i2c_fd_table[I2C_FD_CNT];
+
 static mscc_appl_trace_module_t trace_module = {
     .name = "main"
 };
@@ -57,13 +68,46 @@ static mscc_appl_trace_group_t trace_groups[TRACE_GROUP_CNT] = {
 static mscc_appl_init_t appl_init;
 static void init_modules(mscc_appl_init_t *init);
 
+// Periodic poll tier, driven by a timerfd
+typedef struct {
+    const char           *name;
+    mscc_appl_init_cmd_t cmd;
+    uint32_t             period_us;
+
+    // Statistics
+    uint64_t             runs;     // Number of executions
+    uint64_t             missed;   // Number of periods elapsed without execution
+    uint64_t             total_us; // Accumulated execution time
+    uint32_t             max_us;   // Maximum execution time
+    uint32_t             last_us;  // Last execution time
+} poll_tier_t;
+
+static poll_tier_t poll_tiers[] = {
+    {
+        .name = "fastest",
+        .cmd = MSCC_INIT_CMD_POLL_FASTEST,
+        .period_us = 10000
+    },
+    {
+        .name = "fast",
+        .cmd = MSCC_INIT_CMD_POLL_FAST,
+        .period_us = 10000
+    },
+    {
+        .name = "1sec",
+        .cmd = MSCC_INIT_CMD_POLL,
+        .period_us = 1000000
+    },
+};
+
 /**
  * Open i2c adapter from user space, return the file descriptor for further i2c read/write.
+ * The slave address is given per message in the I2C_RDWR transfers, so one
+ * descriptor serves all devices on the adapter.
  * @param[in] adapter_nr zero by default
- * @param[in] i2c_addr i2c slave address
  * @return fileno
  */
-static int i2c_adapter_open(int adapter_nr, int i2c_addr)
+static int i2c_adapter_open(int adapter_nr)
 {
     char filename[20];  /* 20 char should be enough for holding the file name */
     int file;
@@ -71,15 +115,49 @@ static int i2c_adapter_open(int adapter_nr, int i2c_addr)
     snprintf(filename, sizeof(filename), "/dev/i2c-%d", adapter_nr);
     if ((file = open(filename, O_RDWR)) >= 0) {
         T_I("Opened(%s)", filename);
-        if (ioctl(file, I2C_SLAVE, i2c_addr) < 0) {
-            T_I("cannot specify i2c slave at 0x%02x! [%s]\n", i2c_addr, strerror(errno));
-        }
     } else {
         T_I("cannot open /dev/i2c-%d! [%s]\n", adapter_nr, strerror(errno));
     }
     return file;
 }
 
+/**
+ * Get the i2c adapter file descriptor of a port, opening the adapter on first use.
+ * @param[in] port_no Port number
+ * @return fileno
+ */
+static int i2c_fd_get(mesa_port_no_t port_no)
+{
+    if (port_no >= I2C_FD_CNT) {
+        return i2c_adapter_open(I2C_PORT2DEV(port_no));
+    }
+
+    if (!i2c_fd_table[port_no].open) {
+        if ((i2c_fd_table[port_no].fd = i2c_adapter_open(I2C_PORT2DEV(port_no))) < 0) {
+            return -1;
+        }
+        i2c_fd_table[port_no].open = 1;
+    }
+    return i2c_fd_table[port_no].fd;
+}
+
+/**
+ * Done with the i2c adapter of a port. The descriptor is kept open unless the
+ * transfer failed, in which case the adapter is reopened by the next transfer.
+ * @param[in] port_no Port number
+ * @param[in] file    File descriptor from i2c_fd_get()
+ * @param[in] ok      Whether the transfer succeeded
+ */
+static void i2c_fd_put(mesa_port_no_t port_no, int file, mesa_bool_t ok)
+{
+    if (port_no >= I2C_FD_CNT) {
+        close(file);
+    } else if (!ok) {
+        close(file);
+        i2c_fd_table[port_no].open = 0;
+    }
+}
+
 /**
  * \brief Function for doing i2c reads from the switch i2c controller
  *
@@ -99,7 +177,7 @@ static mesa_rc i2c_read(const mesa_port_no_t port_no,
 {
     int file;
     mesa_rc rc = MESA_RC_ERROR;
-    if ((file = i2c_adapter_open(I2C_PORT2DEV(port_no), i2c_addr)) >= 0) {
+    if ((file = i2c_fd_get(port_no)) >= 0) {
         struct i2c_rdwr_ioctl_data packets;
         struct i2c_msg messages[2];
 
@@ -124,7 +202,7 @@ static mesa_rc i2c_read(const mesa_port_no_t port_no,
         } else {
             rc = MESA_RC_OK;
         }
-        close(file);
+        i2c_fd_put(port_no, file, rc == MESA_RC_OK);
     }
     T_D("i2c read port %d, addr 0x%x, %d bytes - RC %d", port_no, i2c_addr, cnt, rc);
     return rc;
@@ -147,7 +225,7 @@ static mesa_rc i2c_write(const mesa_port_no_t port_no,
 {
     int file;
     mesa_rc rc = MESA_RC_ERROR;
-    if ((file = i2c_adapter_open(I2C_PORT2DEV(port_no), i2c_addr)) >= 0) {
+    if ((file = i2c_fd_get(port_no)) >= 0) {
         struct i2c_rdwr_ioctl_data packets;
         struct i2c_msg messages[1];
 
@@ -165,7 +243,7 @@ static mesa_rc i2c_write(const mesa_port_no_t port_no,
         } else {
             rc = MESA_RC_OK;
         }
-        close(file);
+        i2c_fd_put(port_no, file, rc == MESA_RC_OK);
     }
     T_D("i2c write port %d, addr 0x%x, %d bytes - RC %d", port_no, i2c_addr, cnt, rc);
     return rc;
@@ -744,6 +822,61 @@ static void cli_cmd_board_dump(cli_req_t *req)
     }
 }
 
+typedef struct {
+    mesa_bool_t clear;
+} main_cli_req_t;
+
+static void cli_cmd_poll(cli_req_t *req)
+{
+    main_cli_req_t *mreq = req->module_req;
+    poll_tier_t    *tier;
+    int            i;
+
+    for (i = 0; i < ARRSZ(poll_tiers); i++) {
+        tier = &poll_tiers[i];
+        if (mreq->clear) {
+            tier->runs = 0;
+            tier->missed = 0;
+            tier->total_us = 0;
+            tier->max_us = 0;
+            tier->last_us = 0;
+            continue;
+        }
+        if (i == 0) {
+            cli_table_header("Tier      Period(us)  Runs        Missed      Avg(us)  Max(us)  Last(us)");
+        }
+        cli_printf("%-10s%-12u%-12" PRIu64 "%-12" PRIu64 "%-9" PRIu64 "%-9u%u\n",
+                   tier->name, tier->period_us, tier->runs, tier->missed,
+                   tier->runs ? tier->total_us / tier->runs : 0, tier->max_us, tier->last_us);
+    }
+}
+
+static int cli_parm_keyword(cli_req_t *req)
+{
+    const char     *found;
+    main_cli_req_t *mreq = req->module_req;
+
+    if ((found = cli_parse_find(req->cmd, req->stx)) == NULL)
+        return 1;
+
+    if (!strncmp(found, "clear", 5))
+        mreq->clear = 1;
+    else
+        cli_printf("no match: %s\n", found);
+
+    return 0;
+}
+
+static cli_parm_t cli_parm_table[] = {
+    {
+        "clear",
+        "Clear poll statistics",
+        CLI_PARM_FLAG_NONE,
+        cli_parm_keyword,
+        cli_cmd_poll
+    },
+};
+
 static cli_cmd_t cli_cmd_table[] = {
     {
         "Warm Start",
@@ -755,6 +888,11 @@ static cli_cmd_t cli_cmd_table[] = {
         "Shows boad config",
         cli_cmd_board_dump
     },
+    {
+        "Debug Poll [clear]",
+        "Show or clear poll tier execution time and missed period statistics",
+        cli_cmd_poll
+    },
 };
 
 static void main_cli_init(void)
@@ -765,6 +903,11 @@ static void main_cli_init(void)
     for (i = 0; i < sizeof(cli_cmd_table)/sizeof(cli_cmd_t); i++) {
         mscc_appl_cli_cmd_reg(&cli_cmd_table[i]);
     }
+
+    /* Register parameters */
+    for (i = 0; i < sizeof(cli_parm_table)/sizeof(cli_parm_t); i++) {
+        mscc_appl_cli_parm_reg(&cli_parm_table[i]);
+    }
 }
 
 static int  RESET_FPGA = 0;
@@ -933,31 +1076,48 @@ typedef struct {
     int                fd;
     fd_read_callback_t cb;
     void               *ref;
+    fd_read_prio_t     prio;
 } fd_read_reg_t;
 
 #define FD_REG_MAX 32
-fd_read_reg_t fd_reg_table[FD_REG_MAX];
+static fd_read_reg_t fd_reg_table[FD_REG_MAX];
+static int           epoll_fd = -1;
 
-int fd_read_register(int fd, fd_read_callback_t cb, void *ref)
+static int epoll_fd_get(void)
+{
+    if (epoll_fd < 0 && (epoll_fd = epoll_create1(EPOLL_CLOEXEC)) < 0) {
+        T_E("epoll_create1() failed: %s", strerror(errno));
+    }
+    return epoll_fd;
+}
+
+int fd_read_register_prio(int fd, fd_read_callback_t cb, void *ref, fd_read_prio_t prio)
 {
-    int           i, free = -1;
-    fd_read_reg_t *reg;
+    int                i, free = -1, efd;
+    fd_read_reg_t      *reg;
+    struct epoll_event ev;
 
     if (fd <= 0) {
         T_E("illegal fd: %d", fd);
         return -1;
     }
 
+    if ((efd = epoll_fd_get()) < 0) {
+        return -1;
+    }
+
     for (i = 0; i < FD_REG_MAX; i++) {
         reg = &fd_reg_table[i];
         if (reg->fd == fd) {
             if (cb == NULL) {
                 // Deregistration
                 reg->fd = 0;
+                (void)epoll_ctl(efd, EPOLL_CTL_DEL, fd, NULL);
             } else {
                 // Re-registration
                 reg->cb = cb;
                 reg->ref = ref;
+                reg->prio = prio;
             }
             return 0;
         } else if (cb != NULL && reg->fd == 0 && free < 0) {
@@ -968,14 +1128,78 @@ int fd_read_register(int fd, fd_read_callback_t cb, void *ref)
     if (free < 0) {
         return -1;
     }
+
     // New registration
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    if (epoll_ctl(efd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        T_E("epoll_ctl(%d) failed: %s", fd, strerror(errno));
+        return -1;
+    }
     reg = &fd_reg_table[free];
     reg->fd = fd;
     reg->cb = cb;
     reg->ref = ref;
+    reg->prio = prio;
     return 0;
 }
 
+int fd_read_register(int fd, fd_read_callback_t cb, void *ref)
+{
+    return fd_read_register_prio(fd, cb, ref, FD_READ_PRIO_NORMAL);
+}
+
+static fd_read_reg_t *fd_read_lookup(int fd)
+{
+    int i;
+
+    for (i = 0; i < FD_REG_MAX; i++) {
+        if (fd_reg_table[i].fd == fd) {
+            return &fd_reg_table[i];
+        }
+    }
+    return NULL;
+}
+
+// Wait for file descriptor activity and call the callbacks in priority order
+static void fd_read_poll(void)
+{
+    struct epoll_event events[FD_REG_MAX];
+    fd_read_reg_t      *reg, ready[FD_REG_MAX];
+    int                i, j, n, cnt, efd = epoll_fd_get();
+
+    if (efd < 0) {
+        return;
+    }
+
+    if ((cnt = epoll_wait(efd, events, FD_REG_MAX, -1)) < 0) {
+        if (errno != EINTR) {
+            T_E("epoll_wait() failed: %s", strerror(errno));
+        }
+        return;
+    }
+
+    // Sort ready file descriptors, highest priority first
+    for (i = 0, n = 0; i < cnt; i++) {
+        if ((reg = fd_read_lookup(events[i].data.fd)) == NULL) {
+            continue;
+        }
+        for (j = n; j > 0 && ready[j - 1].prio < reg->prio; j--) {
+            ready[j] = ready[j - 1];
+        }
+        ready[j] = *reg;
+        n++;
+    }
+
+    for (i = 0; i < n; i++) {
+        // A previous callback may have deregistered the file descriptor
+        if ((reg = fd_read_lookup(ready[i].fd)) != NULL) {
+            reg->cb(reg->fd, reg->ref);
+        }
+    }
+}
+
 static mesa_rc gpio_func_info_get(const mesa_inst_t inst, mesa_gpio_func_t gpio_func,  mesa_gpio_func_info_t *info)
 {
     if (appl_init.board_inst->api.meba_gpio_func_info_get != NULL) {
@@ -995,15 +1219,78 @@ static mesa_rc serdes_tap_get(const mesa_inst_t inst, mesa_port_no_t port_no,
     }
 }
 
-mesa_bool_t poll_cnt_us(uint32_t sleep_us, uint32_t *poll_cnt, uint32_t wait_usec)
+static uint64_t time_us_get(void)
 {
-    if ((sleep_us * *poll_cnt) % wait_usec == 0) {
-        return 1;
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static void poll_tier_timer(int fd, void *ref)
+{
+    poll_tier_t *tier = ref;
+    uint64_t    exp, start;
+    uint32_t    usec;
+
+    // The expiration count tells how many periods elapsed since last read
+    if (read(fd, &exp, sizeof(exp)) != sizeof(exp)) {
+        return;
     }
-    if (*poll_cnt > 10000) {
-        *poll_cnt = 0;
+    if (exp > 1) {
+        tier->missed += (exp - 1);
     }
-    return 0;
+
+    start = time_us_get();
+    T_N("poll tier %s", tier->name);
+    appl_init.cmd = tier->cmd;
+    init_modules(&appl_init);
+    if (tier->cmd == MSCC_INIT_CMD_POLL && mesa_poll_1sec(NULL) != MESA_RC_OK) {
+        T_E("mesa_poll_1sec() failed");
+    }
+    usec = (time_us_get() - start);
+    tier->runs++;
+    tier->total_us += usec;
+    tier->last_us = usec;
+    if (usec > tier->max_us) {
+        tier->max_us = usec;
+    }
+}
+
+static mesa_rc poll_tiers_start(void)
+{
+    poll_tier_t       *tier;
+    struct itimerspec its;
+    int               i, fd;
+
+    for (i = 0; i < ARRSZ(poll_tiers); i++) {
+        tier = &poll_tiers[i];
+        if (tier->cmd == MSCC_INIT_CMD_POLL_FASTEST && mesa_capability(NULL, MESA_CAP_PORT_KR_IRQ)) {
+            tier->period_us = 200;
+        }
+
+        if ((fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC)) < 0) {
+            T_E("timerfd_create() failed: %s", strerror(errno));
+            return MESA_RC_ERROR;
+        }
+
+        // Periodic timer, so expirations do not drift with the execution time
+        its.it_interval.tv_sec = (tier->period_us / 1000000);
+        its.it_interval.tv_nsec = (tier->period_us % 1000000) * 1000;
+        its.it_value = its.it_interval;
+        if (timerfd_settime(fd, 0, &its, NULL) < 0) {
+            T_E("timerfd_settime() failed: %s", strerror(errno));
+            close(fd);
+            return MESA_RC_ERROR;
+        }
+
+        if (fd_read_register_prio(fd, poll_tier_timer, tier, FD_READ_PRIO_LOW) < 0) {
+            T_E("fd_read_register_prio() failed");
+            close(fd);
+            return MESA_RC_ERROR;
+        }
+    }
+    return MESA_RC_OK;
 }
 
 int main(int argc, char **argv)
@@ -1018,17 +1305,8 @@ int main(int argc, char **argv)
     meba_port_entry_t  port_entry;
     mesa_port_no_t     port_no;
     mesa_chip_id_t     chip_id;
-    struct timeval     tv;
-    int                i, fd, fd_max;
-    fd_set             rfds;
-    fd_read_reg_t      *reg;
     reg_read_t         reg_read;
     reg_write_t        reg_write;
-    uint32_t           sleep_us = 10000, poll_cnt = 0;
-
-    if (mesa_capability(NULL, MESA_CAP_PORT_KR_IRQ)) {
-        sleep_us = 200;
-    }
 
     // Register trace
     init->cmd = MSCC_INIT_CMD_REG;
@@ -1166,47 +1444,11 @@ int main(int argc, char **argv)
         MEBA_WRAP(meba_reset, init->board_inst, MEBA_FAN_INITIALIZE);
     }
     // Poll modules
+    if (poll_tiers_start() != MESA_RC_OK) {
+        return 1;
+    }
     while (1) {
-        FD_ZERO(&rfds);
-        fd_max = 0;
-        for (i = 0; i < FD_REG_MAX; i++) {
-            fd = fd_reg_table[i].fd;
-            if (fd > 0) {
-                FD_SET(fd, &rfds);
-                if (fd > fd_max) {
-                    fd_max = fd;
-                }
-            }
-        }
-        tv.tv_sec = 0;
-        tv.tv_usec = sleep_us; // was 10000
-        if (select(fd_max + 1, &rfds, NULL, NULL, &tv) < 0) {
-            T_E("select() failed");
-        } else {
-            for (i = 0; i < FD_REG_MAX; i++) {
-                reg = &fd_reg_table[i];
-                if (reg->fd > 0 && FD_ISSET(reg->fd, &rfds)) {
-                    reg->cb(reg->fd, reg->ref);
-                }
-            }
-        }
-        init->cmd = MSCC_INIT_CMD_POLL_FASTEST;
-        init_modules(init);
-        poll_cnt++;
-        if (poll_cnt_us(sleep_us, &poll_cnt, 1000000)) { // 1 sec poll
-            T_N("Call init_modules() and mesa_poll_1sec()");
-            init->cmd = MSCC_INIT_CMD_POLL;
-            init_modules(init);
-            if (MESA_RC_OK != mesa_poll_1sec(NULL)) {  // One sec poll
-                T_E("mesa_poll_1sec() failed");
-            }
-        }
-
-        if (poll_cnt_us(sleep_us, &poll_cnt, 10000)) { // 10 ms poll
-            T_N("MSCC_INIT_CMD_POLL_FAST");
-            init->cmd = MSCC_INIT_CMD_POLL_FAST;
-            init_modules(init);
-        }
+        fd_read_poll();
     }
 
     return 0;
@@ -98,7 +98,16 @@ extern mesa_port_no_t ip_port;
 
 // File descriptor read activity callback registration
 typedef void (*fd_read_callback_t)(int fd, void *ref);
+
+// Callbacks for file descriptors ready at the same time are called in priority order
+typedef enum {
+    FD_READ_PRIO_LOW,    // Periodic poll tiers
+    FD_READ_PRIO_NORMAL, // Default priority
+    FD_READ_PRIO_HIGH    // Interrupts
+} fd_read_prio_t;
+
 int fd_read_register(int fd, fd_read_callback_t callback, void *ref);
+int fd_read_register_prio(int fd, fd_read_callback_t callback, void *ref, fd_read_prio_t prio);
 
 void get_mac_addr(uint8_t *mac);
 void ip_mac_setup(mesa_vid_t vid, mesa_bool_t add);
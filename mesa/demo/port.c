@@ -5,6 +5,7 @@
 
 #include <stdio.h>
 #include <ctype.h>
+#include <time.h>
 #include "microchip/ethernet/switch/api.h"
 #include "microchip/ethernet/board/api.h"
 #include "main.h"
@@ -50,6 +51,44 @@ static port_entry_t *port_table;
 static mesa_bool_t  port_polling = 1;
 static uint32_t     port_poll_cnt;
 
+// Fast link polling. Ports with link changes within the active window are polled on every
+// fast poll, the other ports are polled in round robin order, a few ports at a time.
+#define PORT_POLL_FAST_IDLE_CNT 4
+#define PORT_POLL_ACTIVE_USEC   10000000
+
+static mesa_port_no_t *port_poll_order;     // Polled ports, interleaved across MIIM controllers
+static uint32_t       port_poll_order_cnt;
+static uint32_t       port_poll_next;       // Next round robin index into port_poll_order
+static uint32_t       port_link_down_detect_max; // Worst case link down detection time [usec], see port_link_poll()
+static mesa_bool_t    port_poll_order_update;    // Port capabilities changed, rebuild port_poll_order
+
+// MIIM scan based link monitoring. The MIIM controllers scan the link status bit of the PHY
+// status register, so idle copper ports are only polled when the scan detects a change.
+// The link status bit is latching low, and the scan reads clear the latch. A short link drop
+// is therefore not seen by the PHY status poll, but by the sticky scan mismatch bit, which is
+// handled as a link down event. The API suspends scanning of a PHY while a non-standard page
+// is selected, and the PHY is then polled instead.
+#define PORT_SCAN_REG  1      // PHY status register
+#define PORT_SCAN_LINK 0x0004 // Link status bit
+
+static mesa_bool_t port_scan_enable[MESA_MIIM_CONTROLLERS];
+
+static void port_poll_order_init(void);
+static void port_scan_init(void);
+
+static uint64_t port_time_us(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static mesa_bool_t port_link_active(port_entry_t *entry, uint64_t now)
+{
+    return (entry->link_time != 0 && (now - entry->link_time) < PORT_POLL_ACTIVE_USEC);
+}
+
 const char *mesa_port_if2txt(mesa_port_interface_t if_type)
 {
     switch (if_type) {
@@ -292,7 +331,8 @@ static void sfp_drivers_prepend(meba_sfp_drivers_t drivers)
     }
 }
 
-static void port_setup(mesa_port_no_t port_no, mesa_bool_t aneg, mesa_bool_t init)
+// Setup the PHY and build the port configuration
+static mesa_rc port_setup_conf(mesa_port_no_t port_no, mesa_bool_t aneg, mesa_port_conf_t *pconf)
 {
     port_entry_t            *entry = &port_table[port_no];
     mscc_appl_port_conf_t   *pc = &entry->conf;
@@ -303,7 +343,7 @@ static void port_setup(mesa_port_no_t port_no, mesa_bool_t aneg, mesa_bool_t ini
 
     if (mesa_port_conf_get(NULL, port_no, &conf) != MESA_RC_OK) {
         T_E("mesa_port_conf_get(%u) failed", port_no);
-        return;
+        return MESA_RC_ERROR;
     }
     conf.power_down = (pc->admin.enable ? 0 : 1);
     conf.flow_control.smac.addr[5] = port_no;
@@ -360,7 +400,7 @@ static void port_setup(mesa_port_no_t port_no, mesa_bool_t aneg, mesa_bool_t ini
             }
             if (meba_phy_conf_set(meba_global_inst, port_no, &phy) != MESA_RC_OK) {
                 T_E("meba_phy_conf_set(%u) failed", port_no);
-                return;
+                return MESA_RC_ERROR;
             }
 
             conf.speed = pc->speed;
@@ -382,8 +422,16 @@ static void port_setup(mesa_port_no_t port_no, mesa_bool_t aneg, mesa_bool_t ini
         port_no, mesa_port_if2txt(conf.if_type), mesa_port_spd2txt(conf.speed),
         conf.fdx ? "FDX" : "HDX", conf.flow_control.obey ? "OBEY" : "",
         conf.flow_control.generate ? "GENERATE" : "", conf.loop);
+    *pconf = conf;
+    return MESA_RC_OK;
+}
+
+static void port_setup(mesa_port_no_t port_no, mesa_bool_t aneg, mesa_bool_t init)
+{
+    mesa_port_conf_t conf;
 
-    if (mesa_port_conf_set(NULL, port_no, &conf) != MESA_RC_OK) {
+    if (port_setup_conf(port_no, aneg, &conf) == MESA_RC_OK &&
+        mesa_port_conf_set(NULL, port_no, &conf) != MESA_RC_OK) {
         T_E("mesa_port_conf_set(%u) failed", port_no);
     }
 }
@@ -501,6 +549,10 @@ static void cli_cmd_port_conf(cli_req_t *req, port_cli_cmd_t cmd)
             init = 0;
             switch (cmd) {
             case CLI_CMD_PORT_STATE:
+                if (pc->admin.enable && !req->enable && ps->link) {
+                    // The link is taken down locally, so the time of the link change is known
+                    entry->change_time = port_time_us();
+                }
                 pc->admin.enable = req->enable;
                 break;
             case CLI_CMD_PORT_MODE:
@@ -1095,6 +1147,40 @@ static void cli_cmd_port_stats(cli_req_t *req)
     } /* Port loop */
 }
 
+static void cli_cmd_port_poll_stats(cli_req_t *req)
+{
+    mesa_port_no_t uport, iport;
+    port_entry_t   *entry;
+    port_cli_req_t *mreq = req->module_req;
+    mesa_bool_t    header = 1;
+    uint64_t       now = port_time_us();
+
+    if (mreq->clear) {
+        port_link_down_detect_max = 0;
+    } else {
+        cli_printf("Worst case link down detection: %u msec\n", port_link_down_detect_max / 1000);
+    }
+    for (iport = 0; iport < mesa_port_cnt(NULL); iport++) {
+        uport = iport2uport(iport);
+        entry = &port_table[iport];
+        if (req->port_list[uport] == 0 || !entry->valid) {
+            continue;
+        }
+        if (mreq->clear) {
+            entry->poll_cnt = 0;
+            entry->link_down_detect_max = 0;
+            continue;
+        }
+        if (header) {
+            header = 0;
+            cli_printf("\n");
+            cli_table_header("Port  MIIM  Scan      Polls       Active  Detect Max (msec)");
+        }
+        cli_printf("%-6u%-6d%-10s%-12u%-8s%u\n", uport, entry->meba.map.miim_controller, cli_bool_txt(entry->scan),
+                   entry->poll_cnt, cli_bool_txt(port_link_active(entry, now)), entry->link_down_detect_max / 1000);
+    }
+}
+
 static cli_cmd_t cli_cmd_table[] = {
     {
         "Port State [<port_list>] [enable|disable]",
@@ -1151,6 +1237,11 @@ static cli_cmd_t cli_cmd_table[] = {
         "Set or show the port polling mode",
         cli_cmd_port_polling
     },
+    {
+        "Debug Port Poll [<port_list>] [clear]",
+        "Show or clear link polling statistics",
+        cli_cmd_port_poll_stats
+    },
     {
         "Debug SFP [<port_list>] [full]",
         "Shows all detected SFPs",
@@ -1341,6 +1432,13 @@ static cli_parm_t cli_parm_table[] = {
         cli_parm_keyword,
         cli_cmd_sfp_dump
     },
+    {
+        "clear",
+        "Clear link polling statistics",
+        CLI_PARM_FLAG_NONE,
+        cli_parm_keyword,
+        cli_cmd_port_poll_stats
+    },
 };
 
 static void port_cli_init(void)
@@ -1369,6 +1467,9 @@ static void port_init(meba_inst_t inst)
     port_entry_t          *entry;
     mscc_appl_port_conf_t *pc;
     mesa_rc               rc;
+    mesa_port_no_t        *conf_ports;
+    mesa_port_conf_t      *conf_list;
+    uint32_t              conf_cnt = 0;
 
     // Free old port table
     if (port_table != NULL) {
@@ -1380,6 +1481,14 @@ static void port_init(meba_inst_t inst)
         T_E("port_table calloc() failed");
         return;
     }
+    conf_ports = calloc(port_cnt, sizeof(*conf_ports));
+    conf_list = calloc(port_cnt, sizeof(*conf_list));
+    if (conf_ports == NULL || conf_list == NULL) {
+        T_E("port conf list calloc() failed");
+        free(conf_ports);
+        free(conf_list);
+        return;
+    }
     /* Store the meba inst globally */
     meba_global_inst = inst;
 
@@ -1486,7 +1595,13 @@ static void port_init(meba_inst_t inst)
             entry->in_bound_status = TRUE;
         }
 
-        port_setup(port_no, FALSE, TRUE);
+        if (entry->media_type == MSCC_PORT_TYPE_CU || port_no == loop_port) {
+            // The PHY reset and loop port setup below must follow the MAC configuration
+            port_setup(port_no, FALSE, TRUE);
+        } else if (port_setup_conf(port_no, FALSE, &conf_list[conf_cnt]) == MESA_RC_OK) {
+            // The other ports are configured together after the port loop
+            conf_ports[conf_cnt++] = port_no;
+        }
 
         // Post Mac configuration phy reset in case of Lan8814.
         if (entry->media_type == MSCC_PORT_TYPE_CU) {
@@ -1539,6 +1654,13 @@ static void port_init(meba_inst_t inst)
         }
     } // Port loop
 
+    // Configure the remaining ports in one call, so the waiting phases of the port bring-up are shared
+    if (conf_cnt != 0 && mesa_port_conf_list_set(NULL, conf_cnt, conf_ports, conf_list) != MESA_RC_OK) {
+        T_E("mesa_port_conf_list_set() failed");
+    }
+    free(conf_ports);
+    free(conf_list);
+
     // Install known SFPs (used for comparision when a SFP is insterted)
     sfp_drivers_prepend(meba_cisco_driver_init());
     sfp_drivers_prepend(meba_axcen_driver_init());
@@ -1554,6 +1676,9 @@ static void port_init(meba_inst_t inst)
 
     MEBA_WRAP(meba_reset, inst, MEBA_PORT_RESET_POST);
     MEBA_WRAP(meba_reset, inst, MEBA_PORT_LED_INITIALIZE);
+
+    port_poll_order_init();
+    port_scan_init();
 }
 
 static meba_sfp_device_t *create_device(meba_inst_t inst, meba_sfp_driver_t *driver,
@@ -1646,6 +1771,261 @@ void port_kr_status(mesa_port_no_t  port_no, mesa_bool_t *link)
 }
 
 
+// Order the polled ports so that consecutive PHY accesses use different MIIM controllers
+static void port_poll_order_init(void)
+{
+    uint32_t       port_cnt = mesa_capability(NULL, MESA_CAP_PORT_CNT);
+    mesa_port_no_t port_no;
+    port_entry_t   *entry;
+    uint32_t       *rank, cnt, i, r, max_rank = 0;
+    int            ctrl;
+
+    if (port_poll_order != NULL) {
+        free(port_poll_order);
+    }
+    port_poll_order_cnt = 0;
+    port_poll_next = 0;
+    port_poll_order_update = FALSE;
+    if ((port_poll_order = calloc(port_cnt, sizeof(*port_poll_order))) == NULL ||
+        (rank = calloc(port_cnt, sizeof(*rank))) == NULL) {
+        T_E("port poll order calloc() failed");
+        return;
+    }
+
+    // The rank of a port is its index among the ports on the same controller
+    for (port_no = 0; port_no < port_cnt; port_no++) {
+        entry = &port_table[port_no];
+        for (i = 0, cnt = 0; i < port_no; i++) {
+            if (port_table[i].valid && port_table[i].meba.map.miim_controller == entry->meba.map.miim_controller) {
+                cnt++;
+            }
+        }
+        rank[port_no] = cnt;
+        if (cnt > max_rank) {
+            max_rank = cnt;
+        }
+    }
+
+    for (r = 0; r <= max_rank; r++) {
+        for (ctrl = MESA_MIIM_CONTROLLER_NONE; ctrl < MESA_MIIM_CONTROLLERS; ctrl++) {
+            for (port_no = 0; port_no < port_cnt; port_no++) {
+                entry = &port_table[port_no];
+                if (entry->valid && port_no != loop_port && rank[port_no] == r &&
+                    entry->meba.map.miim_controller == ctrl) {
+                    port_poll_order[port_poll_order_cnt++] = port_no;
+                    break;
+                }
+            }
+        }
+    }
+    free(rank);
+}
+
+static mesa_bool_t port_scan_capable(mesa_port_no_t port_no)
+{
+    port_entry_t *entry = &port_table[port_no];
+
+    return (entry->valid && port_no != loop_port && entry->media_type == MSCC_PORT_TYPE_CU &&
+            !entry->in_bound_status && entry->meba.map.miim_controller >= MESA_MIIM_CONTROLLER_0 &&
+            entry->meba.map.miim_controller < MESA_MIIM_CONTROLLERS && entry->meba.map.miim_addr < 32);
+}
+
+// Setup MIIM scan of the copper ports on each MIIM controller
+static void port_scan_init(void)
+{
+    uint32_t              port_cnt = mesa_capability(NULL, MESA_CAP_PORT_CNT);
+    mesa_port_no_t        port_no;
+    port_entry_t          *entry;
+    mesa_miim_scan_conf_t conf;
+    int                   ctrl;
+    uint8_t               addr;
+
+    for (ctrl = MESA_MIIM_CONTROLLER_0; ctrl < MESA_MIIM_CONTROLLERS; ctrl++) {
+        memset(&conf, 0, sizeof(conf));
+        conf.miim_addr_low = 31;
+        for (port_no = 0; port_no < port_cnt; port_no++) {
+            entry = &port_table[port_no];
+            if (port_scan_capable(port_no) && entry->meba.map.miim_controller == ctrl) {
+                addr = entry->meba.map.miim_addr;
+                conf.enable = TRUE;
+                conf.miim_addr_low = (addr < conf.miim_addr_low ? addr : conf.miim_addr_low);
+                conf.miim_addr_high = (addr > conf.miim_addr_high ? addr : conf.miim_addr_high);
+            }
+        }
+        if (!conf.enable) {
+            if (port_scan_enable[ctrl]) {
+                // No copper ports left on the controller
+                (void)mesa_miim_scan_conf_set(NULL, 0, ctrl, &conf);
+                port_scan_enable[ctrl] = FALSE;
+            }
+            continue;
+        }
+        port_scan_enable[ctrl] = FALSE;
+        conf.addr = PORT_SCAN_REG;
+        conf.mask = PORT_SCAN_LINK;
+        conf.expect = PORT_SCAN_LINK;
+        if (mesa_miim_scan_conf_set(NULL, 0, ctrl, &conf) != MESA_RC_OK) {
+            T_I("MIIM scan not supported on controller %d, using PHY polling", ctrl);
+            continue;
+        }
+        T_I("MIIM scan enabled on controller %d, addr %u-%u", ctrl, conf.miim_addr_low, conf.miim_addr_high);
+        port_scan_enable[ctrl] = TRUE;
+    }
+
+    for (port_no = 0; port_no < port_cnt; port_no++) {
+        entry = &port_table[port_no];
+        entry->scan = (port_scan_capable(port_no) && port_scan_enable[entry->meba.map.miim_controller]);
+        entry->scan_change = FALSE;
+        entry->scan_link_down = FALSE;
+        entry->scan_link = FALSE;
+    }
+}
+
+// Read the MIIM scan status and flag the scanned ports, which need a PHY status poll
+static void port_scan_poll(uint64_t now)
+{
+    uint32_t                port_cnt = mesa_capability(NULL, MESA_CAP_PORT_CNT);
+    mesa_port_no_t          port_no;
+    port_entry_t            *entry;
+    mesa_miim_scan_status_t status[MESA_MIIM_CONTROLLERS];
+    mesa_bool_t             valid[MESA_MIIM_CONTROLLERS];
+    mesa_miim_controller_t  ctrl;
+    uint32_t                mask;
+
+    for (ctrl = MESA_MIIM_CONTROLLER_0; ctrl < MESA_MIIM_CONTROLLERS; ctrl++) {
+        valid[ctrl] = (port_scan_enable[ctrl] && mesa_miim_scan_status_get(NULL, 0, ctrl, &status[ctrl]) == MESA_RC_OK);
+    }
+
+    for (port_no = 0; port_no < port_cnt; port_no++) {
+        entry = &port_table[port_no];
+        if (!entry->scan) {
+            continue;
+        }
+        ctrl = entry->meba.map.miim_controller;
+        if (!valid[ctrl]) {
+            // Scan status unknown, poll the PHY
+            entry->scan_change = TRUE;
+            continue;
+        }
+        mask = (1 << entry->meba.map.miim_addr);
+        if (!(status[ctrl].valid & mask)) {
+            // Not scanned since the previous scan status read, poll the PHY
+            entry->scan_change = TRUE;
+        } else if (entry->status.link) {
+            if (!(status[ctrl].match & mask)) {
+                // Link down
+                entry->scan_change = TRUE;
+            } else if (entry->scan_link && (status[ctrl].mismatch & mask)) {
+                // Link down at some point since the previous scan status read
+                entry->scan_change = TRUE;
+                entry->scan_link_down = TRUE;
+            } else {
+                // Link up since the previous scan status read
+                entry->link_up_time = now;
+            }
+        } else if (status[ctrl].match & mask) {
+            // Link up
+            entry->scan_change = TRUE;
+        }
+        entry->scan_link = entry->status.link;
+    }
+}
+
+// Poll the link status of a port and handle link changes
+static mesa_rc port_link_poll(mesa_port_no_t port_no, mesa_bool_t link_old, uint64_t now)
+{
+    port_entry_t       *entry = &port_table[port_no];
+    mesa_port_status_t *ps = &entry->status;
+    uint64_t           start;
+    uint32_t           detect;
+
+    /* Poll port status and update the status data structure */
+    if (port_status_poll(port_no) != MESA_RC_OK) {
+        entry->valid = FALSE;
+        port_poll_order_update = TRUE;
+        return MESA_RC_ERROR;
+    }
+
+    if (mesa_capability(NULL, MESA_CAP_PORT_KR_IRQ)) {
+        /* Verify KR aneg complete */
+        port_kr_status(port_no, &ps->link);
+    }
+
+    /* Detect link down and disable forwarding on port */
+    if ((!ps->link || ps->link_down || entry->scan_link_down) && link_old) {
+        /* The detection time is measured from the time of a local link change, if known.
+           Otherwise the link went down after it was last seen up by a poll or the MIIM scan,
+           so the time since then is the worst case detection time */
+        start = (entry->change_time != 0 ? entry->change_time : entry->link_up_time);
+        if (start != 0) {
+            detect = (now - start);
+            if (detect > entry->link_down_detect_max) {
+                entry->link_down_detect_max = detect;
+            }
+            if (detect > port_link_down_detect_max) {
+                port_link_down_detect_max = detect;
+            }
+            T_I("link down event on port_no: %u, detected within %u usec", port_no, detect);
+        } else {
+            T_I("link down event on port_no: %u", port_no);
+        }
+        entry->change_time = 0;
+        entry->link_up_time = 0;
+        link_old = 0;
+        entry->link_time = now;
+        mesa_port_state_set(NULL, port_no, FALSE);
+        mesa_mac_table_port_flush(NULL, port_no);
+    }
+
+    /* Detect link up and setup port */
+    if (ps->link && !link_old) {
+        T_I("link up event on port_no: %u spd:%s fdx:%d", port_no, mesa_port_spd2txt(ps->speed), ps->fdx);
+        entry->link_time = now;
+        mesa_port_state_set(NULL, port_no, TRUE);
+        if (port_is_aneg_mode(entry)) {
+            port_setup(port_no, TRUE, FALSE);
+        }
+    }
+    if (ps->link && !ps->link_down && !entry->scan_link_down) {
+        entry->link_up_time = now;
+    }
+    entry->poll_time = now;
+    entry->poll_cnt++;
+    entry->scan_change = FALSE;
+    entry->scan_link_down = FALSE;
+    return MESA_RC_OK;
+}
+
+// Fast link poll: Ports with recent link activity or MIIM scan changes and a round robin slice
+// of the other ports, which are not monitored by MIIM scan
+static void port_poll_fast(void)
+{
+    uint64_t       now = port_time_us();
+    mesa_port_no_t port_no;
+    port_entry_t   *entry;
+    uint32_t       i, idle_cnt = 0;
+
+    port_scan_poll(now);
+
+    for (i = 0; i < port_poll_order_cnt; i++) {
+        port_no = port_poll_order[i];
+        entry = &port_table[port_no];
+        if (entry->valid && (port_link_active(entry, now) || entry->scan_change)) {
+            (void)port_link_poll(port_no, entry->status.link, now);
+        }
+    }
+
+    for (i = 0; i < port_poll_order_cnt && idle_cnt < PORT_POLL_FAST_IDLE_CNT; i++) {
+        port_no = port_poll_order[port_poll_next];
+        port_poll_next = ((port_poll_next + 1) % port_poll_order_cnt);
+        entry = &port_table[port_no];
+        if (entry->valid && !entry->scan && !port_link_active(entry, now)) {
+            (void)port_link_poll(port_no, entry->status.link, now);
+            idle_cnt++;
+        }
+    }
+}
+
 void port_poll(meba_inst_t inst)
 {
     uint32_t              port_cnt = mesa_capability(NULL, MESA_CAP_PORT_CNT);
@@ -1655,6 +2035,7 @@ void port_poll(meba_inst_t inst)
     mesa_bool_t           link_old;
     mscc_appl_port_conf_t *pc;
     mesa_port_counters_t  counters;
+    uint64_t              now = port_time_us();
 
     // Poll port status
     T_N("enter");
@@ -1687,6 +2068,7 @@ void port_poll(meba_inst_t inst)
             } else if (old_sfp_status.present != entry->sfp_status.present) {
                 T_I("SFP was %s port %d", entry->sfp_status.present ? "inserted in" : "removed from", port_no);
                 check_sfp_drv_status(inst, port_no, entry->sfp_status.present);
+                port_poll_order_update = TRUE;
                 if (entry->sfp_status.present) {
                     port_setup(port_no, FALSE, FALSE);
                     ps->link = FALSE;
@@ -1696,32 +2078,14 @@ void port_poll(meba_inst_t inst)
             }
         }
 
-        /* Poll port status and update the status data structure */
-        if (port_status_poll(port_no) != MESA_RC_OK) {
-            entry->valid = FALSE;
-            continue;
+        if (entry->change_time != 0 && (now - entry->change_time) > PORT_POLL_ACTIVE_USEC) {
+            /* The link did not go down after the local change */
+            entry->change_time = 0;
         }
 
-        if (mesa_capability(NULL, MESA_CAP_PORT_KR_IRQ)) {
-            /* Verify KR aneg complete */
-            port_kr_status(port_no, &ps->link);
-        }
-
-        /* Detect link down and disable forwarding on port */
-        if ((!ps->link || ps->link_down) && link_old) {
-            T_I("link down event on port_no: %u", port_no);
-            link_old = 0;
-            mesa_port_state_set(NULL, port_no, FALSE);
-            mesa_mac_table_port_flush(NULL, port_no);
-        }
-
-        /* Detect link up and setup port */
-        if (ps->link && !link_old) {
-            T_I("link up event on port_no: %u spd:%s fdx:%d", port_no, mesa_port_spd2txt(ps->speed), ps->fdx);
-            mesa_port_state_set(NULL, port_no, TRUE);
-            if (port_is_aneg_mode(entry)) {
-                port_setup(port_no, TRUE, FALSE);
-            }
+        /* Poll link status and handle link changes */
+        if (port_link_poll(port_no, link_old, now) != MESA_RC_OK) {
+            continue;
         }
 
         /* Get port counters from the API */
@@ -1729,6 +2093,11 @@ void port_poll(meba_inst_t inst)
         /* Update port LED  through MEBA */
         MEBA_WRAP(meba_port_led_update, inst, port_no, ps, &counters, &pc->admin);
     }
+    if (port_poll_order_update) {
+        /* SFP inserted/removed or port invalidated, the MIIM controller of a port may have changed */
+        port_poll_order_init();
+        port_scan_init();
+    }
     port_poll_cnt++;
     if (port_poll_cnt == 5) {
         // Assume warm start ready
@@ -1771,6 +2140,12 @@ void mscc_appl_port_init(mscc_appl_init_t *init)
         }
         break;
 
+    case MSCC_INIT_CMD_POLL_FAST:
+        if (port_polling) {
+            port_poll_fast();
+        }
+        break;
+
     default:
         break;
     }
@@ -51,6 +51,16 @@ typedef struct {
     meba_sfp_driver_t     sfp_driver;
     mesa_bool_t           in_bound_status; /* TRUE:  get status from switch.
                                               FALSE: get status from phy */
+    uint32_t              poll_cnt;             /* Number of link polls */
+    uint64_t              poll_time;            /* Time of last link poll [usec] */
+    uint64_t              link_time;            /* Time of last link change [usec] */
+    uint64_t              change_time;          /* Time of pending local link change, 0 if unknown [usec] */
+    uint64_t              link_up_time;         /* Last time the link was seen up by a poll or the MIIM scan [usec] */
+    uint32_t              link_down_detect_max; /* Worst case link down detection time [usec] */
+    mesa_bool_t           scan;                 /* Link status monitored by MIIM scan */
+    mesa_bool_t           scan_change;          /* MIIM scan detected a link status change */
+    mesa_bool_t           scan_link_down;       /* MIIM scan detected link down */
+    mesa_bool_t           scan_link;            /* Link status at previous MIIM scan status read */
 } port_entry_t;
 
 mesa_rc mscc_appl_port_status_get(const mesa_port_no_t  port_no,
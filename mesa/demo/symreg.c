@@ -3,6 +3,7 @@
 
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <ctype.h>
 
 #include "microchip/ethernet/switch/api.h"
@@ -96,6 +97,16 @@ typedef struct {
     uint8_t repls[_BF_SIZE(SYMREG_REPL_CNT_MAX)];
     char pattern[SYMREG_NAME_LEN_MAX + SYMREG_REPL_LEN_MAX + 1];
 
+    // Indices of the entries whose names match #pattern. For groups and
+    // registers, the list is built for the table pointed to by #idx_tbl and
+    // reused as long as the table is the same (e.g. all replications of a
+    // target share the same register groups).
+    int        *idx;
+    int        idx_cnt;
+    int        idx_max;
+    int        idx_pos;
+    const void *idx_tbl;
+
     // State variables that remember where we got to.
     int  cur_idx;
     int  cur_repl;
@@ -122,6 +133,10 @@ typedef struct {
 
 static mesa_symreg_data_t SYMREG_DATA;
 
+// Target indices sorted by name (and index), used to find the range of
+// targets matching the literal prefix of a pattern.
+static int *SYMREG_TGT_IDX;
+
 /******************************************************************************/
 //
 // Module Helper functions
@@ -370,49 +385,203 @@ static inline mesa_bool_t SYMREG_match_repl(symreg_state_t *s, uint32_t repl)
     }
 }
 
+/****************************************************************************/
+// SYMREG_prefix_len()
+// Returns the length of the literal part of #s->pattern before the first
+// wildcard.
+/****************************************************************************/
+static size_t SYMREG_prefix_len(symreg_state_t *s)
+{
+    return s->wildcards ? strcspn(s->pattern, "*?") : strlen(s->pattern);
+}
+
+/****************************************************************************/
+// SYMREG_idx_alloc()
+/****************************************************************************/
+static mesa_bool_t SYMREG_idx_alloc(symreg_state_t *s, int cnt)
+{
+    int *idx;
+
+    s->idx_cnt = 0;
+    s->idx_tbl = NULL;
+
+    if (cnt > s->idx_max) {
+        if ((idx = (int *)realloc(s->idx, cnt * sizeof(int))) == NULL) {
+            T_E("%s: Out of memory (%d entries)", s->self_name, cnt);
+            return FALSE;
+        }
+
+        s->idx     = idx;
+        s->idx_max = cnt;
+    }
+
+    return TRUE;
+}
+
+/****************************************************************************/
+// SYMREG_reg_idx_build()
+/****************************************************************************/
+static void SYMREG_reg_idx_build(symreg_state_t *r, mesa_symreg_reg_t const *regs)
+{
+    size_t len = SYMREG_prefix_len(r);
+    int    i;
+
+    if (r->idx_tbl == regs) {
+        return;
+    }
+
+    for (i = 0; regs[i].name != NULL; i++) {
+    }
+
+    if (!SYMREG_idx_alloc(r, i)) {
+        return;
+    }
+
+    for (i = 0; regs[i].name != NULL; i++) {
+        if (strncmp(r->pattern, regs[i].name, len) == 0 && SYMREG_match_name(r, regs[i].name)) {
+            r->idx[r->idx_cnt++] = i;
+        }
+    }
+
+    r->idx_tbl = regs;
+}
+
+/****************************************************************************/
+// SYMREG_grp_idx_build()
+/****************************************************************************/
+static void SYMREG_grp_idx_build(symreg_state_t *g, mesa_symreg_reggrp_t const *reggrps)
+{
+    size_t len = SYMREG_prefix_len(g);
+    int    i;
+
+    if (g->idx_tbl == reggrps) {
+        return;
+    }
+
+    for (i = 0; reggrps[i].name != NULL; i++) {
+    }
+
+    if (!SYMREG_idx_alloc(g, i)) {
+        return;
+    }
+
+    for (i = 0; reggrps[i].name != NULL; i++) {
+        if (strncmp(g->pattern, reggrps[i].name, len) == 0 && SYMREG_match_name(g, reggrps[i].name)) {
+            g->idx[g->idx_cnt++] = i;
+        }
+    }
+
+    g->idx_tbl = reggrps;
+}
+
+/****************************************************************************/
+// SYMREG_int_cmp()
+/****************************************************************************/
+static int SYMREG_int_cmp(const void *a, const void *b)
+{
+    return *(const int *)a - *(const int *)b;
+}
+
+/****************************************************************************/
+// SYMREG_tgt_idx_build()
+// Only the range of the sorted target index that shares the pattern's
+// literal prefix is considered. The matches are returned in table order.
+/****************************************************************************/
+static void SYMREG_tgt_idx_build(symreg_state_t *t)
+{
+    const mesa_symreg_target_t *targets = SYMREG_DATA.targets;
+    size_t                     len = SYMREG_prefix_len(t);
+    int                        lo = 0, hi = SYMREG_DATA.targets_cnt, mid, i;
+
+    if (t->idx_tbl == targets || !SYMREG_idx_alloc(t, SYMREG_DATA.targets_cnt)) {
+        return;
+    }
+
+    t->idx_tbl = targets;
+
+    if (len == 0 || SYMREG_TGT_IDX == NULL) {
+        for (i = 0; i < (int)SYMREG_DATA.targets_cnt; i++) {
+            if (SYMREG_match_name(t, targets[i].name)) {
+                t->idx[t->idx_cnt++] = i;
+            }
+        }
+
+        return;
+    }
+
+    // Find the first target whose name is not below the prefix
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (strncmp(targets[SYMREG_TGT_IDX[mid]].name, t->pattern, len) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    for (i = lo; i < (int)SYMREG_DATA.targets_cnt; i++) {
+        const char *name = targets[SYMREG_TGT_IDX[i]].name;
+
+        if (strncmp(name, t->pattern, len) != 0) {
+            break;
+        }
+
+        if (SYMREG_match_name(t, name)) {
+            t->idx[t->idx_cnt++] = SYMREG_TGT_IDX[i];
+        }
+    }
+
+    if (t->wildcards) {
+        // Entries with the same name are already in table order.
+        qsort(t->idx, t->idx_cnt, sizeof(int), SYMREG_int_cmp);
+    }
+}
+
 /****************************************************************************/
 // SYMREG_reg_next()
 /****************************************************************************/
 static mesa_bool_t SYMREG_reg_next(symreg_state_t *r, mesa_symreg_reg_t const *regs)
 {
-    if (r->cur_idx < 0 || r->cur_repl >= (int)regs[r->cur_idx].repl_cnt - 1) {
-        // Either we're not started, or we've matched the last
-        // replication in the previous iteration. Find next
-        // matching register by name.
+    if (r->cur_idx < 0) {
+        // Not started. Find the matching registers by name.
+        SYMREG_reg_idx_build(r, regs);
+        r->idx_pos  = 0;
         r->cur_repl = -1;
-        r->cur_idx++;
+    } else if (r->cur_repl >= (int)regs[r->cur_idx].repl_cnt - 1) {
+        // We've matched the last replication in the previous iteration.
+        r->cur_repl = -1;
+        r->idx_pos++;
     }
 
-    while (regs[r->cur_idx].name != NULL) {
+    while (r->idx_pos < r->idx_cnt) {
         uint32_t repl;
 
+        r->cur_idx = r->idx[r->idx_pos];
         r->u.r = &regs[r->cur_idx];
 
-        if (SYMREG_match_name(r, r->u.r->name)) {
-            // Name match. Check to see if there is a replication fit.
-            r->matched_at_least_one_name = TRUE;
-
-            for (repl = r->cur_repl + 1; repl < r->u.r->repl_cnt; repl++) {
-                if (SYMREG_match_repl(r, repl)) {
-                    r->cur_repl = repl;
-                    r->match_cnt++;
-                    r->match_addr = 4 * (repl * r->u.r->repl_width + r->u.r->addr);
+        // Name match. Check to see if there is a replication fit.
+        r->matched_at_least_one_name = TRUE;
 
-                    if (r->u.r->repl_cnt == 1) {
-                        strcpy(r->match_name, r->u.r->name);
-                    } else {
-                        sprintf(r->match_name, "%s[%u]", r->u.r->name, r->cur_repl);
-                    }
+        for (repl = r->cur_repl + 1; repl < r->u.r->repl_cnt; repl++) {
+            if (SYMREG_match_repl(r, repl)) {
+                r->cur_repl = repl;
+                r->match_cnt++;
+                r->match_addr = 4 * (repl * r->u.r->repl_width + r->u.r->addr);
 
-                    r->match_width = strlen(r->match_name);
-                    return TRUE;
+                if (r->u.r->repl_cnt == 1) {
+                    strcpy(r->match_name, r->u.r->name);
+                } else {
+                    sprintf(r->match_name, "%s[%u]", r->u.r->name, r->cur_repl);
                 }
+
+                r->match_width = strlen(r->match_name);
+                return TRUE;
             }
         }
 
         // No replication match
         r->cur_repl = -1;
-        r->cur_idx++;
+        r->idx_pos++;
     }
 
     return FALSE;
@@ -423,44 +592,46 @@ static mesa_bool_t SYMREG_reg_next(symreg_state_t *r, mesa_symreg_reg_t const *r
 /****************************************************************************/
 static mesa_bool_t SYMREG_grp_next(symreg_state_t *g, mesa_symreg_reggrp_t const *reggrps)
 {
-    if (g->cur_idx < 0 || g->cur_repl >= (int)reggrps[g->cur_idx].repl_cnt - 1) {
-        // Either we're not started, or we've matched the last
-        // replication in the previous iteration. Find next
-        // matching group by name.
+    if (g->cur_idx < 0) {
+        // Not started. Find the matching groups by name.
+        SYMREG_grp_idx_build(g, reggrps);
+        g->idx_pos  = 0;
+        g->cur_repl = -1;
+    } else if (g->cur_repl >= (int)reggrps[g->cur_idx].repl_cnt - 1) {
+        // We've matched the last replication in the previous iteration.
         g->cur_repl = -1;
-        g->cur_idx++;
+        g->idx_pos++;
     }
 
-    while (reggrps[g->cur_idx].name != NULL) {
+    while (g->idx_pos < g->idx_cnt) {
         uint32_t repl;
 
+        g->cur_idx = g->idx[g->idx_pos];
         g->u.g = &reggrps[g->cur_idx];
 
-        if (SYMREG_match_name(g, g->u.g->name)) {
-            // Name match. Check to see if there is a replication fit.
-            g->matched_at_least_one_name = TRUE;
+        // Name match. Check to see if there is a replication fit.
+        g->matched_at_least_one_name = TRUE;
 
-            for (repl = g->cur_repl + 1; repl < g->u.g->repl_cnt; repl++) {
-                if (SYMREG_match_repl(g, repl)) {
-                    g->cur_repl = repl;
-                    g->match_cnt++;
-                    g->match_addr = 4 * (g->u.g->base_addr + repl * g->u.g->repl_width);
+        for (repl = g->cur_repl + 1; repl < g->u.g->repl_cnt; repl++) {
+            if (SYMREG_match_repl(g, repl)) {
+                g->cur_repl = repl;
+                g->match_cnt++;
+                g->match_addr = 4 * (g->u.g->base_addr + repl * g->u.g->repl_width);
 
-                    if (g->u.g->repl_cnt == 1) {
-                        strcpy(g->match_name, g->u.g->name);
-                    } else {
-                        sprintf(g->match_name, "%s[%u]", g->u.g->name, g->cur_repl);
-                    }
-
-                    g->match_width = strlen(g->match_name);
-                    return TRUE;
+                if (g->u.g->repl_cnt == 1) {
+                    strcpy(g->match_name, g->u.g->name);
+                } else {
+                    sprintf(g->match_name, "%s[%u]", g->u.g->name, g->cur_repl);
                 }
+
+                g->match_width = strlen(g->match_name);
+                return TRUE;
             }
         }
 
         // No replication match
         g->cur_repl = -1;
-        g->cur_idx++;
+        g->idx_pos++;
     }
 
     return FALSE;
@@ -472,40 +643,45 @@ static mesa_bool_t SYMREG_grp_next(symreg_state_t *g, mesa_symreg_reggrp_t const
 static mesa_bool_t SYMREG_tgt_next(symreg_state_t *t)
 {
     // Each target only has one replication.
-    t->cur_idx++;
+    if (t->cur_idx < 0) {
+        // Not started. Find the matching targets by name.
+        SYMREG_tgt_idx_build(t);
+        t->idx_pos = 0;
+    } else {
+        t->idx_pos++;
+    }
 
-    while (t->cur_idx < SYMREG_DATA.targets_cnt) {
+    while (t->idx_pos < t->idx_cnt) {
+        t->cur_idx = t->idx[t->idx_pos];
         t->u.t = &SYMREG_DATA.targets[t->cur_idx];
 
-        if (SYMREG_match_name(t, t->u.t->name)) {
-            // Target repolications are special in that a replication number
-            // of -1 indicates that it's not replicated. All replications
-            // are explicit, because targets may lie on different base
-            // addresses, which are not evenly distanced.
-            // We allow targets with no replications to be indexed by
-            // replication 0:
-            uint32_t repl = t->u.t->repl_number < 0 ? 0 : t->u.t->repl_number;
-
-            t->matched_at_least_one_name = TRUE;
-
-            if (SYMREG_match_repl(t, repl)) {
-                t->cur_repl = repl; // Zero-based (not -1)
-                t->match_cnt++;
-                t->match_addr = t->u.t->base_addr;
-
-                if (t->u.t->repl_number < 0) {
-                    // Target not replicated
-                    strcpy(t->match_name, t->u.t->name);
-                } else {
-                    sprintf(t->match_name, "%s[%u]", t->u.t->name, t->cur_repl);
-                }
+        // Target repolications are special in that a replication number
+        // of -1 indicates that it's not replicated. All replications
+        // are explicit, because targets may lie on different base
+        // addresses, which are not evenly distanced.
+        // We allow targets with no replications to be indexed by
+        // replication 0:
+        uint32_t repl = t->u.t->repl_number < 0 ? 0 : t->u.t->repl_number;
 
-                t->match_width = strlen(t->match_name);
-                return TRUE;
+        t->matched_at_least_one_name = TRUE;
+
+        if (SYMREG_match_repl(t, repl)) {
+            t->cur_repl = repl; // Zero-based (not -1)
+            t->match_cnt++;
+            t->match_addr = t->u.t->base_addr;
+
+            if (t->u.t->repl_number < 0) {
+                // Target not replicated
+                strcpy(t->match_name, t->u.t->name);
+            } else {
+                sprintf(t->match_name, "%s[%u]", t->u.t->name, t->cur_repl);
             }
+
+            t->match_width = strlen(t->match_name);
+            return TRUE;
         }
 
-        t->cur_idx++;
+        t->idx_pos++;
     }
 
     return FALSE;
@@ -679,6 +855,20 @@ static const char *symreg_error_txt(mesa_rc rc)
     }
 }
 
+/******************************************************************************/
+// SYMREG_inst_free()
+/******************************************************************************/
+static void SYMREG_inst_free(symreg_inst_t *inst)
+{
+    int i;
+
+    for (i = 0; i < SYMREG_COMPONENTS_LAST; i++) {
+        free(inst->state[i].idx);
+    }
+
+    free(inst);
+}
+
 /******************************************************************************/
 // symreg_query_init()
 /******************************************************************************/
@@ -826,7 +1016,7 @@ do_exit:
     if (rc == MESA_RC_OK) {
         *handle = inst;
     } else {
-        free(inst);
+        SYMREG_inst_free(inst);
     }
 
     return rc;
@@ -841,7 +1031,7 @@ static mesa_rc symreg_query_uninit(void *handle)
         return SYMREG_RC_PARAM;
     }
 
-    free(handle);
+    SYMREG_inst_free((symreg_inst_t *)handle);
     return MESA_RC_OK;
 }
 
@@ -984,15 +1174,38 @@ do_exit:
     return;
 }
 
+/******************************************************************************/
+// SYMREG_tgt_name_cmp()
+/******************************************************************************/
+static int SYMREG_tgt_name_cmp(const void *a, const void *b)
+{
+    int i = *(const int *)a, j = *(const int *)b;
+    int rc = strcmp(SYMREG_DATA.targets[i].name, SYMREG_DATA.targets[j].name);
+
+    return rc ? rc : i - j;
+}
+
 /******************************************************************************/
 // symreg_init()
 /******************************************************************************/
 static void symreg_init(void)
 {
+    int i;
+
     if (mesa_symreg_data_get(0, &SYMREG_DATA) != MESA_RC_OK) {
         T_E("Failed to get symreg-data");
     }
 
+    // Build the target name index. Without it, targets are searched linearly.
+    if (SYMREG_DATA.targets_cnt &&
+        (SYMREG_TGT_IDX = (int *)malloc(SYMREG_DATA.targets_cnt * sizeof(int))) != NULL) {
+        for (i = 0; i < (int)SYMREG_DATA.targets_cnt; i++) {
+            SYMREG_TGT_IDX[i] = i;
+        }
+
+        qsort(SYMREG_TGT_IDX, SYMREG_DATA.targets_cnt, sizeof(int), SYMREG_tgt_name_cmp);
+    }
+
     if (SYMREG_DATA.repl_cnt_max > SYMREG_REPL_CNT_MAX) {
         T_E("SYMREG_REPL_CNT_MAX repl buffer is too small (%u > %u) - will cause memory overwrite!", SYMREG_DATA.repl_cnt_max, SYMREG_REPL_CNT_MAX);
         T_E("This is a bug!");
@@ -0,0 +1,45 @@
+#!/usr/bin/env ruby
+
+# Copyright (c) 2004-2020 Microchip Technology Inc. and its subsidiaries.
+# SPDX-License-Identifier: MIT
+
+require_relative 'libeasy/et'
+
+$ts = get_test_setup("mesa_pc_b2b_4x")
+
+# Boot-time benchmark of the port bring-up. The API profile accumulates the phases
+# since the API instance was created, so right after boot it holds the boot numbers.
+# The sleep_usec column is the requested sleep time, which does not depend on the
+# speed of the CPU or the emulator.
+PROF_PHASES = ["port_conf_list_prepare", "serdes_cfg_list", "port_conf_set", "serdes_cfg"]
+
+def prof_get
+    prof = {}
+    $ts.dut.run("mesa-cmd debug api init")[:out].each_line do |l|
+        next unless l =~ /^Profile: (\w+),(\d+),(\d+),(\d+),(\d+),(\d+),(\d+)/
+        prof[$1] = {cnt: $2.to_i, usec: $3.to_i, wait_usec: $4.to_i, sleep_usec: $5.to_i}
+    end
+    prof
+end
+
+test "port-boot-sleep" do
+    prof = prof_get
+    if (prof["port_conf_set"].nil?)
+        t_e("No port_conf_set profile, API profiling not supported")
+        break
+    end
+
+    PROF_PHASES.each do |name|
+        p = prof[name]
+        next if p.nil?
+        t_i("#{name}: cnt: #{p[:cnt]}, usec: #{p[:usec]}, wait_usec: #{p[:wait_usec]}, sleep_usec: #{p[:sleep_usec]}")
+    end
+
+    # The Serdes phases are nested within the port phases
+    sleep_usec = 0
+    ["port_conf_list_prepare", "port_conf_set"].each do |name|
+        sleep_usec += prof[name][:sleep_usec] unless prof[name].nil?
+    end
+    t_i("Port bring-up slept #{sleep_usec / 1000} msec for #{prof["port_conf_set"][:cnt]} port configurations")
+    t_i("Total slept #{prof["total"][:sleep_usec] / 1000} msec") unless prof["total"].nil?
+end
@@ -0,0 +1,60 @@
+#!/usr/bin/env ruby
+
+# Copyright (c) 2004-2020 Microchip Technology Inc. and its subsidiaries.
+# SPDX-License-Identifier: MIT
+
+require_relative 'libeasy/et'
+
+$ts = get_test_setup("mesa_pc_b2b_2x")
+
+check_capabilities do
+    $cap_xdlb = ($ts.dut.call("mesa_capability", "MESA_CAP_L2_XDLB") != 0)
+    assert($cap_xdlb == true, "Dual leaky Bucket it not supported")
+end
+
+#---------- Configuration -----------------------------------------------------
+
+$cnt = 1000
+$rates = [100, 1000, 10000, 100000, 1000000, 10000000]
+
+def bench(name)
+    t0 = Process.clock_gettime(Process::CLOCK_MONOTONIC)
+    yield
+    t = Process.clock_gettime(Process::CLOCK_MONOTONIC) - t0
+    t_i("#{name}: #{$cnt} policers in %.2f sec, %.0f policers/sec" % [t, $cnt / t])
+end
+
+def pol_set(pol, enable, rate)
+    conf = $ts.dut.call("mesa_dlb_policer_conf_get", pol, 0)
+    conf["enable"] = enable
+    conf["type"] = "MESA_POLICER_TYPE_MEF"
+    conf["cir"] = rate
+    conf["cbs"] = 4096
+    conf["eir"] = rate
+    conf["ebs"] = 4096
+    $ts.dut.call("mesa_dlb_policer_conf_set", pol, 0, conf)
+end
+
+test "dlb_policer_churn" do
+    pols = []
+    $cnt.times do
+        pols << $ts.dut.call("mesa_dlb_policer_alloc", 1)
+    end
+
+    # Enable all policers, spread over the LB groups
+    bench("enable") do
+        pols.each_with_index { |pol, i| pol_set(pol, true, $rates[i % $rates.size]) }
+    end
+
+    # Move policers between LB groups in random order
+    bench("change rate") do
+        pols.shuffle.each_with_index { |pol, i| pol_set(pol, true, $rates[(i * 7) % $rates.size]) }
+    end
+
+    # Remove policers from the LB groups in random order
+    bench("disable") do
+        pols.shuffle.each { |pol| pol_set(pol, false, 0) }
+    end
+
+    pols.each { |pol| $ts.dut.call("mesa_dlb_policer_free", pol) }
+end
@@ -0,0 +1,101 @@
+#!/usr/bin/env ruby
+
+# Copyright (c) 2004-2020 Microchip Technology Inc. and its subsidiaries.
+# SPDX-License-Identifier: MIT
+
+require 'socket'
+require 'json'
+require 'optparse'
+
+# Default methods: generated methods with scalar and struct results, plus a static one
+$options = { :port => 1234, :cnt => 10000, :sessions => 1, :depth => 1, :batch => 1, :params => [],
+             :methods => [["mesa_capability", ["MESA_CAP_PORT_CNT"]],
+                          ["mesa_vlan_port_conf_get", [0]],
+                          ["mesa_misc_get", []]] }
+OptionParser.new do |opts|
+    opts.banner = "Usage: json_rpc_bench.rb [options] <dut-ip>"
+
+    opts.on("-h", "--help", "This message") do |v|
+        puts opts
+        exit
+    end
+
+    opts.on("-p", "--port port", "JSON-RPC TCP port (default 1234)") do |p|
+        $options[:port] = p.to_i
+    end
+
+    opts.on("-n", "--count cnt", "Messages per session (default 10000)") do |n|
+        $options[:cnt] = n.to_i
+    end
+
+    opts.on("-s", "--sessions cnt", "Concurrent sessions (default 1)") do |s|
+        $options[:sessions] = s.to_i
+    end
+
+    opts.on("-d", "--depth cnt", "Requests in flight per session (default 1)") do |d|
+        $options[:depth] = d.to_i
+    end
+
+    opts.on("-b", "--batch cnt", "Requests per batch message (default 1, no batch)") do |b|
+        $options[:batch] = b.to_i
+    end
+
+    opts.on("-m", "--method name", "Method to call instead of the default methods") do |m|
+        $options[:method] = m
+    end
+
+    opts.on("-a", "--params json", "Method parameters as a JSON array (use with --method)") do |a|
+        $options[:params] = JSON.parse(a)
+    end
+end.parse!
+
+if ARGV.size != 1
+    puts "DUT IP address missing"
+    exit 1
+end
+
+$options[:methods] = [[$options[:method], $options[:params]]] if $options[:method]
+
+def msg(method, params, id)
+    req = {'method' => method, 'params' => params, 'id' => id}
+    req = (0...$options[:batch]).map { |i| req.merge('id' => id * $options[:batch] + i) } if $options[:batch] > 1
+    req = req.to_json
+    [req.bytesize].pack('N') + req.b
+end
+
+def reply(s)
+    len = s.read(4).unpack('N')[0]
+    resp = JSON.parse(s.read(len).force_encoding('UTF-8'))
+    resp = [resp] unless resp.is_a?(Array)
+    resp.each { |r| raise "#{r["error"]}" unless r["error"].nil? }
+    resp[0]["id"] / $options[:batch]
+end
+
+# Keep 'depth' requests outstanding and check that replies come back in order
+def session(host, method, params)
+    s = TCPSocket.open(host, $options[:port])
+    s.setsockopt(Socket::IPPROTO_TCP, Socket::TCP_NODELAY, 1)
+    tx = 0
+    rx = 0
+    while rx < $options[:cnt]
+        while tx < $options[:cnt] && (tx - rx) < $options[:depth]
+            s.write(msg(method, params, tx))
+            tx += 1
+        end
+        id = reply(s)
+        raise "reply #{id} out of order, expected #{rx}" if id != rx
+        rx += 1
+    end
+    s.close
+end
+
+$options[:methods].each do |method, params|
+    t0 = Process.clock_gettime(Process::CLOCK_MONOTONIC)
+    threads = (1..$options[:sessions]).map { Thread.new { session(ARGV[0], method, params) } }
+    threads.each { |t| t.join }
+    t = Process.clock_gettime(Process::CLOCK_MONOTONIC) - t0
+    total = $options[:cnt] * $options[:sessions] * $options[:batch]
+
+    puts "#{method}: #{total} requests, #{$options[:sessions]} session(s), depth #{$options[:depth]}, batch #{$options[:batch]}: " +
+         "%.2f sec, %.0f requests/sec" % [t, total / t]
+end
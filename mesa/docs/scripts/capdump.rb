@@ -89,6 +89,12 @@ ARGV.each do |lib|
             end
         end
 
+        if status.exitstatus == 2
+            # The cached capability value differs from the uncached value
+            puts stderr_str
+            exit 1
+        end
+
         if status.to_i != 0
             cap = caps.shift
             puts "%-40s %-60s = <unknown>" % [base_lib, "#{cap[0]}(#{cap[1]})"]
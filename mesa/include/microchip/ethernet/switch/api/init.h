@@ -439,6 +439,8 @@ typedef struct {
     mesa_restart_t restart;      // Previous restart mode
     mesa_version_t prev_version; // Previous API version
     mesa_version_t cur_version;  // Current API version
+    uint32_t       sync_entries; // Table entries read back and checked by warm start synchronization
+    uint32_t       sync_changed; // Table entries written by warm start synchronization
 } mesa_restart_status_t;
 
 // Get restart status
@@ -221,6 +221,17 @@ mesa_rc mesa_port_conf_set(const mesa_inst_t       inst,
                            const mesa_port_no_t    port_no,
                            const mesa_port_conf_t  *const conf);
 
+// Set port configuration for a list of ports.
+// The ports are configured as by mesa_port_conf_set(), but the waiting phases
+// of the bring-up are done once for all ports instead of once per port.
+// cnt [IN]        Number of entries in port_list and conf_list.
+// port_list [IN]  Port numbers.
+// conf_list [IN]  Port setup structures, one per entry in port_list.
+mesa_rc mesa_port_conf_list_set(const mesa_inst_t       inst,
+                                const uint32_t          cnt,
+                                const mesa_port_no_t    *const port_list,
+                                const mesa_port_conf_t  *const conf_list);
+
 // Get port configuration.
 // port_no [IN]  Port number.
 // conf [OUT]    Port configuration.
@@ -478,6 +489,83 @@ mesa_rc mesa_miim_write(const mesa_inst_t            inst,
                         const uint8_t                addr,
                         const uint16_t               value);
 
+// MIIM register access, used for access lists
+typedef struct {
+    mesa_miim_controller_t miim_controller; // MIIM Controller Instance
+    uint8_t                miim_addr;       // MIIM Device Address
+    uint8_t                addr;            // MIIM Register Address
+    mesa_bool_t            write;           // Write access if TRUE, read access otherwise
+    uint16_t               value;           // Register value to write or register value read
+    mesa_rc                rc;              // Return code of the access
+} mesa_miim_access_t;
+
+// Direct MIIM access list (bypassing port map).
+// Accesses on the same MIIM controller are done in list order, while
+// accesses on different MIIM controllers may be done concurrently.
+// chip_no [IN]     Chip number (if multi-chip instance).
+// cnt     [IN]     Number of entries in list.
+// list    [IN/OUT] List of accesses. The value and rc fields are updated.
+// Returns MESA_RC_ERROR if any of the accesses failed.
+mesa_rc mesa_miim_access_list(const mesa_inst_t        inst,
+                              const mesa_chip_no_t     chip_no,
+                              const uint32_t           cnt,
+                              mesa_miim_access_t *const list);
+
+// MIIM scan configuration
+typedef struct {
+    mesa_bool_t enable;         // Enable automatic scanning of a PHY register
+    uint8_t     miim_addr_low;  // Lowest MIIM Device Address scanned
+    uint8_t     miim_addr_high; // Highest MIIM Device Address scanned
+    uint8_t     addr;           // MIIM Register Address scanned (Clause 22)
+    uint16_t    mask;           // Mask used when comparing the register value with the expected value
+    uint16_t    expect;         // Expected register value
+} mesa_miim_scan_conf_t;
+
+// Get MIIM scan configuration.
+// chip_no         [IN]  Chip number (if multi-chip instance).
+// miim_controller [IN]  MIIM Controller Instance
+// conf            [OUT] Scan configuration.
+mesa_rc mesa_miim_scan_conf_get(const mesa_inst_t            inst,
+                                const mesa_chip_no_t         chip_no,
+                                const mesa_miim_controller_t miim_controller,
+                                mesa_miim_scan_conf_t        *const conf);
+
+// Set MIIM scan configuration.
+// While scanning is enabled, the MIIM controller continuously reads the register from
+// the PHYs in the address range and compares it with the expected value.
+// Direct MIIM accesses on the controller suspend the scanning while in progress.
+// Scanning also stays suspended while a Clause 22 write to register 31 has left a PHY
+// in the address range on a non-standard page. Page 0 (register 31 value zero) is
+// assumed to be the standard page, as for the Microchip PHYs.
+// Note that scanning reads the register continuously. If the register has latching
+// bits, like the latched-low link status in register 1, the scan reads clear them.
+// A PHY driver reading the register can then no longer see a short link drop, which
+// is only reported by the mismatch bit of mesa_miim_scan_status_get().
+// Returns MESA_RC_ERROR if scanning is not supported.
+// chip_no         [IN]  Chip number (if multi-chip instance).
+// miim_controller [IN]  MIIM Controller Instance
+// conf            [IN]  Scan configuration.
+mesa_rc mesa_miim_scan_conf_set(const mesa_inst_t            inst,
+                                const mesa_chip_no_t         chip_no,
+                                const mesa_miim_controller_t miim_controller,
+                                const mesa_miim_scan_conf_t  *const conf);
+
+// MIIM scan status. Bit N is used for MIIM Device Address N.
+typedef struct {
+    uint32_t valid;    // Scan result is valid
+    uint32_t match;    // Last register value read matched the expected value
+    uint32_t mismatch; // Register value has mismatched the expected value since last status get
+} mesa_miim_scan_status_t;
+
+// Get MIIM scan status.
+// chip_no         [IN]  Chip number (if multi-chip instance).
+// miim_controller [IN]  MIIM Controller Instance
+// status          [OUT] Scan status.
+mesa_rc mesa_miim_scan_status_get(const mesa_inst_t            inst,
+                                  const mesa_chip_no_t         chip_no,
+                                  const mesa_miim_controller_t miim_controller,
+                                  mesa_miim_scan_status_t      *const status);
+
 // Read value from MMD register.
 // port_no [IN]  Port number connected to MMD.
 // mmd     [IN]  MMD number.
@@ -820,6 +908,16 @@ mesa_rc mesa_port_kr_irq_get(const mesa_inst_t inst,
                              uint32_t *const irq_vec)
     CAP(PORT_KR_IRQ);
 
+// Get and clear KR interrupts for a list of ports in one pass
+// cnt       [IN]  Number of entries in port_list and irq_list.
+// port_list [IN]  Port numbers.
+// irq_list  [OUT] Interrupt vector for each entry in port_list.
+mesa_rc mesa_port_kr_irq_list_get(const mesa_inst_t inst,
+                                  const uint32_t cnt,
+                                  const mesa_port_no_t *const port_list,
+                                  uint32_t *const irq_list)
+    CAP(PORT_KR_IRQ);
+
 /**
  * \brief Enable / Disable KR IRQs
  *
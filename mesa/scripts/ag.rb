@@ -125,6 +125,9 @@ $methods_blacklist = [
     "mesa_callout_unlock",
     "mesa_vlan_trans_group_to_port_get",
     "mesa_vlan_trans_group_to_port_set",
+    "mesa_miim_access_list",
+    "mesa_port_conf_list_set",
+    "mesa_port_kr_irq_list_get",
 ]
 
 $conv_methods = {}
@@ -194,7 +194,17 @@ void mesa_cap_callback_add(mesa_inst_t inst, mesa_cap_callback_data_t *hook)
 #define MESA_EVENT_EXT_SYNC 5 /* Local definition of external synchronisation event ID */
 #define MESA_BIT(x) (1 << (x))
 
-uint32_t mesa_capability(mesa_inst_t inst, int cap)
+/* Capabilities below this value are cached in cap_table[] */
+#define MESA_CAP_TABLE_SIZE (MESA_CAP_MRP_CNT + 1)
+
+/* Cached capability values plus one, zero means not cached yet. Each entry
+   is a single word, so concurrent lookups see either zero or the value. */
+static uint32_t cap_table[MESA_CAP_TABLE_SIZE];
+
+/* Capability value. Values which depend on the instance, on the chip (read
+   through the API) or on the application callback clear '*fixed' and are not
+   cached. */
+static uint32_t cap_get(mesa_inst_t inst, int cap, mesa_bool_t *fixed)
 {
     uint32_t c = 0;
 
@@ -364,6 +374,8 @@ uint32_t mesa_capability(mesa_inst_t inst, int cap)
     case MESA_CAP_MISC_CPU_TYPE: {
         vtss_state_t *vtss_state;
 
+        *fixed = FALSE;
+
         if ((vtss_state = vtss_inst_check_no_persist((const vtss_inst_t)inst)) == NULL) {
             VTSS_E("Unable to get state from inst = %p", inst);
             MESA_ASSERT(0);
@@ -1483,6 +1495,7 @@ uint32_t mesa_capability(mesa_inst_t inst, int cap)
             mesa_chip_id_t chip_id;
             mesa_rc rc;
 
+            *fixed = FALSE;
             rc = mesa_chip_id_get(inst, &chip_id);  /* check if chip revision is >= rev B */
             if (rc == MESA_RC_OK && chip_id.revision >= 1) {
                 c = 1;
@@ -1850,6 +1863,7 @@ uint32_t mesa_capability(mesa_inst_t inst, int cap)
             mesa_chip_id_t chip_id = {};
             mesa_rc        rc;
 
+            *fixed = FALSE;
             if ((rc = mesa_chip_id_get(NULL, &chip_id)) != VTSS_RC_OK) {
                 break;
             }
@@ -1928,6 +1942,7 @@ uint32_t mesa_capability(mesa_inst_t inst, int cap)
     default:
         {
             mesa_cap_callback_data_t *hook = NULL;
+            *fixed = FALSE;
             if (vtss_misc_appdata_get((vtss_inst_t)inst, (void**)&hook) == VTSS_RC_OK && hook != NULL) {
                 c = hook->cb(hook->inst, cap);
             } else {
@@ -1941,6 +1956,31 @@ uint32_t mesa_capability(mesa_inst_t inst, int cap)
     return c;
 }
 
+/* Capability value without the cap_table[] lookup. Not part of the API, used
+   by capability_dumper to check the cached values against cap_get(). */
+uint32_t mesa_capability_uncached(mesa_inst_t inst, int cap)
+{
+    mesa_bool_t fixed = TRUE;
+
+    return cap_get(inst, cap, &fixed);
+}
+
+uint32_t mesa_capability(mesa_inst_t inst, int cap)
+{
+    mesa_bool_t fixed = TRUE;
+    uint32_t    c;
+
+    if (cap >= 0 && cap < MESA_CAP_TABLE_SIZE && cap_table[cap] != 0) {
+        return cap_table[cap] - 1;
+    }
+
+    c = cap_get(inst, cap, &fixed);
+    if (fixed && cap >= 0 && cap < MESA_CAP_TABLE_SIZE) {
+        cap_table[cap] = c + 1;
+    }
+    return c;
+}
+
 uint32_t mesa_port_cnt(mesa_inst_t inst)
 {
     return mesa_capability(inst, MESA_CAP_PORT_CNT);
@@ -12,6 +12,8 @@ int main(int argc, char *argv[]) {
     int i, cap;
     void *handle;
     uint32_t (*capability)(mesa_inst_t, int);
+    uint32_t (*capability_uncached)(mesa_inst_t, int);
+    uint32_t val, val_cached;
 
     char *error;
 
@@ -32,9 +34,23 @@ int main(int argc, char *argv[]) {
         exit(1);
     }
 
+    // Libraries without the capability cache do not have this symbol
+    capability_uncached = dlsym(handle, "mesa_capability_uncached");
+    (void)dlerror();
+
     for (i = 2; i < argc; ++i) {
         cap = atoi(argv[i]);
-        printf("%d %u\n", cap, (*capability)(0, cap));
+        val = (*capability)(0, cap);
+        if (capability_uncached != NULL) {
+            // Check the cached value (second lookup) against the uncached value
+            val_cached = (*capability)(0, cap);
+            if (val_cached != val || (*capability_uncached)(0, cap) != val) {
+                fprintf(stderr, "Capability %d: cached value %u differs from uncached value %u\n",
+                        cap, val_cached, (*capability_uncached)(0, cap));
+                exit(2);
+            }
+        }
+        printf("%d %u\n", cap, val);
         fflush(stdout);
     }
 
@@ -5,54 +5,81 @@
 #include <vtss_api.h>
 #include <mesa.h>
 
+/* Port lists are converted a byte (eight ports) at a time. The unpack
+   table holds the eight member flags of each byte value. */
+#define PL_BYTE(b)   { (b) & 1, ((b) >> 1) & 1, ((b) >> 2) & 1, ((b) >> 3) & 1, \
+                       ((b) >> 4) & 1, ((b) >> 5) & 1, ((b) >> 6) & 1, ((b) >> 7) & 1 }
+#define PL_BYTE4(b)  PL_BYTE(b), PL_BYTE((b) + 1), PL_BYTE((b) + 2), PL_BYTE((b) + 3)
+#define PL_BYTE16(b) PL_BYTE4(b), PL_BYTE4((b) + 4), PL_BYTE4((b) + 8), PL_BYTE4((b) + 12)
+#define PL_BYTE64(b) PL_BYTE16(b), PL_BYTE16((b) + 16), PL_BYTE16((b) + 32), PL_BYTE16((b) + 48)
+
+static const mesa_bool_t port_list_unpack[256][8] = {
+    PL_BYTE64(0), PL_BYTE64(64), PL_BYTE64(128), PL_BYTE64(192)
+};
+
 mesa_rc mesa_conv_uint8_t_to_mesa_port_list_t(const mesa_bool_t in[VTSS_PORT_ARRAY_SIZE], mesa_port_list_t *out)
 {
-    vtss_port_no_t port_no;
+    uint32_t i, port_no;
+    uint8_t  b;
+
+    for (i = 0, port_no = 0; port_no + 8 <= VTSS_PORTS; i++, port_no += 8) {
+        b = (in[port_no + 0] ? 0x01 : 0) | (in[port_no + 1] ? 0x02 : 0) |
+            (in[port_no + 2] ? 0x04 : 0) | (in[port_no + 3] ? 0x08 : 0) |
+            (in[port_no + 4] ? 0x10 : 0) | (in[port_no + 5] ? 0x20 : 0) |
+            (in[port_no + 6] ? 0x40 : 0) | (in[port_no + 7] ? 0x80 : 0);
+        out->_private[i] = b;
+    }
 
-    for (port_no = 0; port_no < VTSS_PORTS; port_no++) {
-        mesa_port_list_set(out, port_no, in[port_no]);
+    if (port_no < VTSS_PORTS) {
+        // Remaining ports, bits above VTSS_PORTS are left unchanged
+        b = out->_private[i] & (0xff << (VTSS_PORTS - port_no));
+        for (; port_no < VTSS_PORTS; port_no++) {
+            b |= (in[port_no] ? 1 : 0) << (port_no % 8);
+        }
+        out->_private[i] = b;
     }
     return VTSS_RC_OK;
 }
 
 mesa_rc mesa_conv_mesa_port_list_t_to_uint8_t(const mesa_port_list_t *in, mesa_bool_t out[VTSS_PORT_ARRAY_SIZE])
 {
-    vtss_port_no_t port_no;
+    uint32_t i, port_no;
 
-    for (port_no = 0; port_no < VTSS_PORTS; port_no++) {
-        out[port_no] = mesa_port_list_get(in, port_no);
+    for (i = 0, port_no = 0; port_no + 8 <= VTSS_PORTS; i++, port_no += 8) {
+        memcpy(&out[port_no], port_list_unpack[in->_private[i]], 8);
+    }
+
+    if (port_no < VTSS_PORTS) {
+        memcpy(&out[port_no], port_list_unpack[in->_private[i]], VTSS_PORTS - port_no);
     }
     return VTSS_RC_OK;
 }
 
 #if defined(VTSS_FEATURE_VCAP)
-#define VTSS_BF_GET(a, n)    ((a[(n)/8] & (1<<((n)%8))) ? 1 : 0)
-#define VTSS_BF_SET(a, n, v) do { if (v) { a[(n)/8] |= (1U<<((n)%8)); } else { a[(n)/8] &= ~(1U<<((n)%8)); }} while (0)
+/* The VTSS port bitfield has the same layout as the MESA port list, so
+   whole bytes are copied. Bits above VTSS_PORTS are left unchanged. */
+#define PORT_LIST_COPY(dst, src)                                    \
+do {                                                                \
+    uint32_t _i;                                                    \
+    for (_i = 0; _i < VTSS_PORTS / 8; _i++) {                       \
+        (dst)[_i] = (src)[_i];                                      \
+    }                                                               \
+    if (VTSS_PORTS % 8) {                                           \
+        uint8_t _mask = (uint8_t)(0xff << (VTSS_PORTS % 8));        \
+        (dst)[_i] = ((dst)[_i] & _mask) | ((src)[_i] & ~_mask);     \
+    }                                                               \
+} while (0)
 
 mesa_rc mesa_conv2_vtss_vlan_trans_port2grp_conf_t_to_mesa_vlan_trans_port2grp_conf_t(const vtss_vlan_trans_port2grp_conf_t *in, mesa_vlan_trans_port2grp_conf_t *out)
 {
-    vtss_port_no_t port_no;
-    mesa_bool_t    member[VTSS_PORT_ARRAY_SIZE];
-
-    for (port_no = 0; port_no < VTSS_PORTS; port_no++) {
-        member[port_no] = VTSS_BF_GET(in->ports, port_no);
-    }
-
-    return mesa_conv_uint8_t_to_mesa_port_list_t(member, &out->port_list);
+    PORT_LIST_COPY(out->port_list._private, in->ports);
+    return VTSS_RC_OK;
 }
 
 mesa_rc mesa_conv2_mesa_vlan_trans_port2grp_conf_t_to_vtss_vlan_trans_port2grp_conf_t(const mesa_vlan_trans_port2grp_conf_t *in, vtss_vlan_trans_port2grp_conf_t *out)
 {
-    mesa_rc        rc;
-    vtss_port_no_t port_no;
-    mesa_bool_t    member[VTSS_PORT_ARRAY_SIZE];
-
-    if ((rc = mesa_conv_mesa_port_list_t_to_uint8_t(&in->port_list, member)) == VTSS_RC_OK) {
-        for (port_no = 0; port_no < VTSS_PORTS; port_no++) {
-            VTSS_BF_SET(out->ports, port_no, member[port_no]);
-        }
-    }
-    return rc;
+    PORT_LIST_COPY(out->ports, in->port_list._private);
+    return VTSS_RC_OK;
 }
 
 mesa_rc mesa_conv2_vtss_vce_key_t_to_mesa_vce_key_t(const vtss_vce_key_t *in, mesa_vce_key_t *out)
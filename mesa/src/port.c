@@ -95,6 +95,77 @@ mesa_rc mesa_port_map_set(const mesa_inst_t     inst,
     return vtss_port_map_set((const vtss_inst_t)inst, vtss_map);
 }
 
+mesa_rc mesa_port_conf_list_set(const mesa_inst_t       inst,
+                                const uint32_t          cnt,
+                                const mesa_port_no_t    *const port_list,
+                                const mesa_port_conf_t  *const conf_list)
+{
+    vtss_port_no_t   vtss_port[VTSS_PORTS];
+    vtss_port_conf_t vtss_conf[VTSS_PORTS];
+    uint32_t         i;
+
+    if (cnt > VTSS_PORTS) {
+        return MESA_RC_ERROR;
+    }
+
+    for (i = 0; i < cnt; i++) {
+        vtss_port[i] = port_list[i];
+        mesa_conv_mesa_port_conf_t_to_vtss_port_conf_t(&conf_list[i], &vtss_conf[i]);
+    }
+    return vtss_port_conf_list_set((const vtss_inst_t)inst, cnt, vtss_port, vtss_conf);
+}
+
+mesa_rc mesa_port_kr_irq_list_get(const mesa_inst_t inst,
+                                  const uint32_t cnt,
+                                  const mesa_port_no_t *const port_list,
+                                  uint32_t *const irq_list)
+{
+#if defined(VTSS_FEATURE_PORT_KR_IRQ)
+    vtss_port_no_t vtss_port[VTSS_PORTS];
+    uint32_t       i;
+
+    if (cnt > VTSS_PORTS) {
+        return MESA_RC_ERROR;
+    }
+
+    for (i = 0; i < cnt; i++) {
+        vtss_port[i] = port_list[i];
+    }
+    return vtss_port_kr_irq_list_get((const vtss_inst_t)inst, cnt, vtss_port, irq_list);
+#else
+    return MESA_RC_ERROR;
+#endif
+}
+
+#define MESA_MIIM_ACCESS_CHUNK 64
+
+mesa_rc mesa_miim_access_list(const mesa_inst_t        inst,
+                              const mesa_chip_no_t     chip_no,
+                              const uint32_t           cnt,
+                              mesa_miim_access_t *const list)
+{
+    mesa_rc            rc = MESA_RC_OK;
+    vtss_miim_access_t vtss_list[MESA_MIIM_ACCESS_CHUNK];
+    uint32_t           i, j, n;
+
+    for (i = 0; i < cnt; i += n) {
+        n = (cnt - i);
+        if (n > MESA_MIIM_ACCESS_CHUNK) {
+            n = MESA_MIIM_ACCESS_CHUNK;
+        }
+        for (j = 0; j < n; j++) {
+            mesa_conv_mesa_miim_access_t_to_vtss_miim_access_t(&list[i + j], &vtss_list[j]);
+        }
+        if (vtss_miim_access_list((const vtss_inst_t)inst, chip_no, n, vtss_list) != VTSS_RC_OK) {
+            rc = MESA_RC_ERROR;
+        }
+        for (j = 0; j < n; j++) {
+            mesa_conv_vtss_miim_access_t_to_mesa_miim_access_t(&vtss_list[j], &list[i + j]);
+        }
+    }
+    return rc;
+}
+
 #ifndef VTSS_CHIP_10G_PHY
 mesa_bool_t mesa_phy_10G_is_valid(const mesa_inst_t inst, const mesa_port_no_t port_no)
 {